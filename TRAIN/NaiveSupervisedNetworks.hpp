@@ -40,7 +40,9 @@
 ***********
 */
 
-/// Crude geometric weights crafter.
+/** Crude geometric weights crafter. Optionally, the altered weights are importance sampled proportionally to
+    their decaying credits from previous improvements, instead of at uniformly random intervals.
+*/
 class GeometricWeightsCrafter : public WeightsCrafter
 {
   // DEFINITIONS //
@@ -55,6 +57,30 @@ public:
   // Arbitrarily determined by trial-and-error.
   constexpr static Index const MaximumWeightDeltaDelta{ MaximumWeightDelta / 1000 };
 
+  using Credit = double;
+  // Each improvement's credit weighs this much less at the next one. Arbitrarily determined.
+  constexpr static Credit const CreditDecay{ 0.99 };
+  // Instead of decaying all the credits, the credit increment grows, until it is rescaled down to 1 past this.
+  constexpr static Credit const MaximumCreditIncrement{ 1e100 };
+  // One importance sampled index in UniformSamplingOneIn is sampled uniformly instead, to keep exploring.
+  constexpr static Index const UniformSamplingOneIn{ 4 };
+
+  /* Per weights region step scales, grown on success and shrunk on failure so that they stabilize around a 1/5
+     success rate. Arbitrarily determined.
+  */
+  constexpr static double const StepScaleGrowth{ 1.2 };
+  constexpr static double const StepScaleShrink{ 0.955 }; // About StepScaleGrowth ^ -(1/4).
+  constexpr static double const MinimumStepScale{ 1.0 / 64 };
+  // Weight of the last outcome in each weights region's success rate average.
+  constexpr static double const SuccessRateSmoothing{ 0.05 };
+  // No weights region gets sampled less than this relatively to the most successful one.
+  constexpr static double const MinimumSamplingRate{ 0.125 };
+
+  // Direct-mapped tabu list size, a power of 2.
+  constexpr static Index const TabuSignaturesCount{ 4096 };
+  // Tabu alterings are re-randomized at most this many times in a row, before evaluating them anyway.
+  constexpr static Index const MaximumTabuRetriesCount{ 16 };
+
   // INSTANCE VARIABLES //
 private:
   decltype(myWeights) myBestWeights;
@@ -70,6 +96,38 @@ private:
   bool myCrawlToLocalMaximum; // Trying up and down previously successful random alterations in increments of 1.
   bool myWeightsPreviouslyImproved;
 
+  bool const myImportanceSampling;
+  // Improvement credit of each weight, empty if not importance sampling.
+  FenwickTree<Credit> myCredits;
+  Credit myCreditIncrement{ 1 };
+  // Whether the current alterings were applied to the weights, thus deserve credit if they improve.
+  bool myAlteringsWereApplied{ false };
+
+  // Adaptive state of each weights region, only adapted if there are more than one.
+  struct WeightsRegion
+  {
+    Index beginIndex;
+    // Scales myMaximumWeightDelta for the region's weights.
+    double stepScale{ 1 };
+    double successRate{ 0.2 };
+    // Probability to keep each uniformly sampled weight of the region.
+    double samplingRate{ 1 };
+    // Whether the current alterings alter a weight of the region.
+    bool altered{ false };
+  };
+  std::vector<WeightsRegion> myWeightsRegions{ { 0 } };
+  // Index in myWeightsRegions of each weight.
+  std::vector<uint16_t> myWeightRegionIndexes;
+
+  /* Signatures of the alterings rejected since the weights last improved, indexed by their lowest bits.
+     0 is empty. A signature hashes the altered indexes, their directions and the delta class.
+  */
+  std::vector<uint64_t> myTabuSignatures;
+  // Signature of the alterings last applied by #alterWeights.
+  uint64_t myAlteringsSignature{ 0 };
+  uint64_t myTabuLookupsCount{ 0 };
+  uint64_t myTabuHitsCount{ 0 };
+
   // DESTRUCTOR //
 public:
   // Rule of five.
@@ -80,11 +138,16 @@ public:
   /// Deleted.
   GeometricWeightsCrafter() = delete;
 
-  explicit GeometricWeightsCrafter(Index const weightsCount)
+  /// @param[in] importanceSampling Whether to importance sample the altered weights by improvement credits.
+  explicit GeometricWeightsCrafter(Index const weightsCount, bool const importanceSampling = false)
     : WeightsCrafter(weightsCount)
     , myBestWeights(weightsCount)
     , myAlterWeightsIndexes(weightsCount + 1)
     , myAlterDirections(weightsCount)
+    , myImportanceSampling(importanceSampling)
+    , myCredits(importanceSampling ? weightsCount : 0)
+    , myWeightRegionIndexes(weightsCount, 0)
+    , myTabuSignatures(TabuSignaturesCount, 0)
   {
     rememberWeights();
     randomizeAlterings();
@@ -109,12 +172,14 @@ private:
     // noexcept if instantiating and calling a std::geometric_distribution are both noexcept.
     noexcept(noexcept(std::geometric_distribution<decltype((*myRandomIntegerPointer)())>()) and noexcept(
       std::geometric_distribution<decltype((*myRandomIntegerPointer)())>()(
-        *myRandomIntegerPointer)) and noexcept((*myRandomIntegerPointer)()) and noexcept(myRandomBoolean()))
+        *myRandomIntegerPointer)) and noexcept((*myRandomIntegerPointer)()) and noexcept(myRandomBoolean()) and
+             noexcept(importanceSampleAlterings()))
   {
     // Not crawling to local maximum (anymore).
     myCrawlToLocalMaximum = false;
     // Newly created alterings do not yet improve the weights.
     myWeightsPreviouslyImproved = false;
+    myAlteringsWereApplied = false;
 
     // Decrease the P Numerator, or reset if too small.
     if ((myAlteringsPNumerator *= AlteringsPNumeratorMultiplier) < myAlteringsMinimumPNumerator)
@@ -130,15 +195,22 @@ private:
       myMaximumWeightsInterval = myWeightsCount;
 
     Index index{ 0 };
-    if (myMaximumWeightsInterval > 1) {
+    if ((myMaximumWeightsInterval > 1) and myImportanceSampling and (myCredits.total() > 0))
+      index = importanceSampleAlterings();
+    else if (myMaximumWeightsInterval > 1) {
       // weightsIndex is initialized in interval [0, myWeightsCount).
       for (Index weightsIndex{ static_cast<Index>((*myRandomIntegerPointer)() % myMaximumWeightsInterval) };
            weightsIndex < myWeightsCount;
            // weightsIndex is incremented in interval [1, myWeightsCount].
-           weightsIndex += static_cast<Index>(((*myRandomIntegerPointer)() % myMaximumWeightsInterval) + 1),
-           ++index) {
+           weightsIndex += static_cast<Index>(((*myRandomIntegerPointer)() % myMaximumWeightsInterval) + 1)) {
+        // Keep the weight according to its region's sampling rate.
+        auto const samplingRate{ myWeightsRegions[myWeightRegionIndexes[weightsIndex]].samplingRate };
+        if ((samplingRate < 1) and
+            (std::ldexp(static_cast<double>((*myRandomIntegerPointer)()), -64) >= samplingRate))
+          continue;
+
         myAlterWeightsIndexes[index] = weightsIndex;
-        myAlterDirections[index] = myRandomBoolean();
+        myAlterDirections[index++] = myRandomBoolean();
       }
     } else {
       for (; index != myWeightsCount; ++index) {
@@ -149,6 +221,104 @@ private:
     myAlterWeightsIndexes[index] = InvalidIndex;
   }
 
+  /** Sample as many weights indexes as uniformly random intervals would on average, proportionally to their credits.
+      @return The count of distinct sampled indexes.
+  */
+  Index importanceSampleAlterings() noexcept(noexcept((*myRandomIntegerPointer)()) and noexcept(myRandomBoolean()))
+  {
+    // Intervals in [1, myMaximumWeightsInterval] average (myMaximumWeightsInterval + 1) / 2.
+    auto const samplesCount{ static_cast<Index>(((uint64_t{ myWeightsCount } * 2) + myMaximumWeightsInterval) /
+                                                (myMaximumWeightsInterval + 1)) };
+    auto const creditsTotal{ myCredits.total() };
+
+    for (Index index{ 0 }; index != samplesCount; ++index)
+      if (((*myRandomIntegerPointer)() % UniformSamplingOneIn) == 0)
+        myAlterWeightsIndexes[index] = static_cast<Index>((*myRandomIntegerPointer)() % myWeightsCount);
+      else {
+        // Uniform cumulated credit in [0, creditsTotal).
+        auto const cumulatedCredit{ std::ldexp(static_cast<Credit>((*myRandomIntegerPointer)()), -64) * creditsTotal };
+        myAlterWeightsIndexes[index] =
+          std::min(static_cast<Index>(myCredits.find(cumulatedCredit)), static_cast<Index>(myWeightsCount - 1));
+      }
+
+    // Alter each sampled weight once, in increasing order.
+    std::sort(myAlterWeightsIndexes.begin(), myAlterWeightsIndexes.begin() + samplesCount);
+    auto const sampledCount{ static_cast<Index>(
+      std::unique(myAlterWeightsIndexes.begin(), myAlterWeightsIndexes.begin() + samplesCount) -
+      myAlterWeightsIndexes.begin()) };
+    for (Index index{ 0 }; index != sampledCount; ++index)
+      myAlterDirections[index] = myRandomBoolean();
+
+    return sampledCount;
+  }
+
+  /** Adapt the step scale and success rate of each weights region the current alterings altered,
+      then the sampling rates relatively to the most successful region.
+  */
+  void adaptWeightsRegions(bool const improved) noexcept
+  {
+    if ((myWeightsRegions.size() < 2) or myCrawlToLocalMaximum or (not myAlteringsWereApplied))
+      return;
+
+    for (Index index{ 0 }, weightsIndex; (weightsIndex = myAlterWeightsIndexes[index]) != InvalidIndex; ++index)
+      myWeightsRegions[myWeightRegionIndexes[weightsIndex]].altered = true;
+
+    double maximumSuccessRate{ 0 };
+    for (auto&& weightsRegion : myWeightsRegions) {
+      if (weightsRegion.altered) {
+        weightsRegion.altered = false;
+        weightsRegion.stepScale = std::clamp(
+          weightsRegion.stepScale * (improved ? StepScaleGrowth : StepScaleShrink), MinimumStepScale, 1.0);
+        weightsRegion.successRate += ((improved ? 1.0 : 0.0) - weightsRegion.successRate) * SuccessRateSmoothing;
+      }
+      maximumSuccessRate = std::max(maximumSuccessRate, weightsRegion.successRate);
+    }
+    for (auto&& weightsRegion : myWeightsRegions)
+      weightsRegion.samplingRate =
+        (maximumSuccessRate > 0) ? std::max(weightsRegion.successRate / maximumSuccessRate, MinimumSamplingRate) : 1;
+  }
+
+  // Credit the currently altered weights for improving, the latest improvement weighing the most.
+  void creditAlterings() noexcept
+  {
+    for (Index index{ 0 }, weightsIndex; (weightsIndex = myAlterWeightsIndexes[index]) != InvalidIndex; ++index)
+      myCredits.add(weightsIndex, myCreditIncrement);
+
+    if ((myCreditIncrement /= CreditDecay) > MaximumCreditIncrement) {
+      myCredits.scale(1 / myCreditIncrement);
+      myCreditIncrement = 1;
+    }
+  }
+
+  /** @param[in] deltaClass 0 when crawling, else the bit width of the maximum weight delta.
+      @return The non-zero signature of the current alterings.
+  */
+  uint64_t alteringsSignature(uint64_t const deltaClass) const noexcept
+  {
+    // Mix each altered index and direction into the signature, SplitMix64 style.
+    auto const mix{ [](uint64_t value) {
+      value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+      value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+      return value ^ (value >> 31);
+    } };
+
+    uint64_t signature{ mix(deltaClass) };
+    for (Index index{ 0 }, weightsIndex; (weightsIndex = myAlterWeightsIndexes[index]) != InvalidIndex; ++index)
+      signature = mix(signature ^ ((uint64_t{ weightsIndex } << 1) | myAlterDirections[index]));
+    return signature | 1;
+  }
+
+  /// @return True if the alterings last applied were rejected since the weights last improved.
+  bool alteringsAreTabu() noexcept
+  {
+    ++myTabuLookupsCount;
+    if (myTabuSignatures[myAlteringsSignature & (TabuSignaturesCount - 1)] != myAlteringsSignature)
+      return false;
+
+    ++myTabuHitsCount;
+    return true;
+  }
+
   // Alter each weight its alter direction,
   bool alterWeights() noexcept(noexcept((*myRandomIntegerPointer)()))
   {
@@ -178,13 +348,17 @@ private:
         myMaximumWeightDelta -= weightDeltaDelta;
 
       WeightCalculator newWeight;
-      for (Index index{ 0 }, weightsIndex; (weightsIndex = myAlterWeightsIndexes[index]) != InvalidIndex; ++index)
+      for (Index index{ 0 }, weightsIndex; (weightsIndex = myAlterWeightsIndexes[index]) != InvalidIndex; ++index) {
+        // Scale the maximum weight delta by the weight's region step scale.
+        auto const stepScale{ myWeightsRegions[myWeightRegionIndexes[weightsIndex]].stepScale };
+        auto const maximumWeightDelta{ std::max(static_cast<WeightCalculator>(myMaximumWeightDelta * stepScale),
+                                                WeightCalculator{ 1 }) };
         // Increase weight.
         if (myAlterDirections[index]) {
           if (myWeights[weightsIndex] < MaximumWeight) {
             // Linearly randomize weight delta according to the maximum weight delta.
             newWeight = myWeights[weightsIndex] +
-                        static_cast<WeightCalculator>((*myRandomIntegerPointer)() % myMaximumWeightDelta) + 1;
+                        static_cast<WeightCalculator>((*myRandomIntegerPointer)() % maximumWeightDelta) + 1;
             if (newWeight >= MaximumWeight)
               myWeights[weightsIndex] = MaximumWeight;
             else
@@ -197,7 +371,7 @@ private:
           if (myWeights[weightsIndex] > MinimumWeight) {
             // Linearly randomize weight delta according to the maximum weight delta.
             newWeight = myWeights[weightsIndex] -
-                        static_cast<WeightCalculator>((*myRandomIntegerPointer)() % myMaximumWeightDelta) - 1;
+                        static_cast<WeightCalculator>((*myRandomIntegerPointer)() % maximumWeightDelta) - 1;
             if (newWeight <= MinimumWeight)
               myWeights[weightsIndex] = MinimumWeight;
             else
@@ -206,8 +380,18 @@ private:
             noWeightWasAltered = false;
           }
         }
+      }
     }
 
+    if (not noWeightWasAltered) {
+      myAlteringsWereApplied = true;
+
+      uint64_t deltaClass{ 0 };
+      if (not myCrawlToLocalMaximum)
+        for (auto maximumWeightDelta{ myMaximumWeightDelta }; maximumWeightDelta; maximumWeightDelta /= 2)
+          ++deltaClass;
+      myAlteringsSignature = alteringsSignature(deltaClass);
+    }
     return noWeightWasAltered;
   }
 
@@ -236,6 +420,11 @@ public:
   {
     rememberWeights();
     myWeightsPreviouslyImproved = true;
+    if (myImportanceSampling and myAlteringsWereApplied)
+      creditAlterings();
+    adaptWeightsRegions(true);
+    // The rejected alterings were relative to the previous best weights.
+    std::fill(myTabuSignatures.begin(), myTabuSignatures.end(), 0);
 
     /* Alter the weights similarly since they improved,
        or re-randomize the alterings until at least one weight gets altered.
@@ -249,6 +438,9 @@ public:
     noexcept(bringBackBestWeights()) and noexcept(randomizeAlterings()) and noexcept(alterWeights())) override
   {
     bringBackBestWeights();
+    adaptWeightsRegions(false);
+    if (myAlteringsWereApplied)
+      myTabuSignatures[myAlteringsSignature & (TabuSignaturesCount - 1)] = myAlteringsSignature;
 
     // Crawl to the local maximum around the lastly successful random alterations.
     if (myCrawlToLocalMaximum)
@@ -279,16 +471,66 @@ public:
       else
         randomizeAlterings();
 
-    // Alter the weights again, or reset the alterings until at least one weight gets altered.
-    while (alterWeights())
-      randomizeAlterings();
+    /* Alter the weights again, or reset the alterings until at least one weight gets altered
+       and, within reason, the alterings were not already rejected.
+    */
+    for (Index tabuRetriesCount{ 0 };;)
+      if (alterWeights())
+        randomizeAlterings();
+      else if ((tabuRetriesCount++ != MaximumTabuRetriesCount) and alteringsAreTabu()) {
+        bringBackBestWeights();
+        randomizeAlterings();
+      } else
+        break;
   }
 
+  decltype(myBestWeights) const& bestWeights() const noexcept override { return myBestWeights; }
+
   /// Log useful informations about the current state.
   void logCurrentState(Logger& logger) const override
   {
     logger << "Maximum weight delta is " << myMaximumWeightDelta << '/' << MaximumWeightDelta
            << ". Maximum interval is " << myMaximumWeightsInterval << '/' << myWeightsCount << ".\n";
+    if (myImportanceSampling) {
+      Index creditedWeightsCount{ 0 };
+      for (Index index{ 0 }; index != myWeightsCount; ++index)
+        if (myCredits[index] > 0)
+          ++creditedWeightsCount;
+      logger << "    ◦ " << creditedWeightsCount << '/' << myWeightsCount
+             << " weights hold improvement credits to be importance sampled.\n";
+    }
+    if (myTabuLookupsCount)
+      logger << "    ◦ Tabu list hit rate is "
+             << (static_cast<double>(myTabuHitsCount * 100) / static_cast<double>(myTabuLookupsCount)) << "% of "
+             << myTabuLookupsCount << " lookups.\n";
+    if (myWeightsRegions.size() > 1) {
+      logger << "    ◦ Step scale and sampling rate per weights region:";
+      for (auto const& weightsRegion : myWeightsRegions)
+        logger << ' ' << weightsRegion.stepScale << '/' << weightsRegion.samplingRate;
+      logger << ".\n";
+    }
+  }
+
+  /// Adapt separately the step scale and sampling rate of each of the weightsRegions.
+  void setWeightsRegions(WeightsRegions const& weightsRegions) override
+  {
+    if (weightsRegions.empty() or weightsRegions.front() or
+        (weightsRegions.size() > std::numeric_limits<decltype(myWeightRegionIndexes)::value_type>::max()))
+      throw std::logic_error(String(+"Invalid weightsRegions in: ", +__PRETTY_FUNCTION__, '.'));
+
+    myWeightsRegions.clear();
+    for (Index regionIndex{ 0 }; regionIndex != weightsRegions.size(); ++regionIndex) {
+      auto const beginIndex{ weightsRegions[regionIndex] };
+      auto const endIndex{ ((regionIndex + 1) == weightsRegions.size()) ? myWeightsCount
+                                                                        : weightsRegions[regionIndex + 1] };
+      if ((beginIndex >= endIndex) or (endIndex > myWeightsCount))
+        throw std::logic_error(String(+"Invalid weightsRegions in: ", +__PRETTY_FUNCTION__, '.'));
+
+      myWeightsRegions.push_back({ beginIndex });
+      std::fill(myWeightRegionIndexes.begin() + beginIndex,
+                myWeightRegionIndexes.begin() + endIndex,
+                static_cast<decltype(myWeightRegionIndexes)::value_type>(regionIndex));
+    }
   }
 };
 
@@ -301,9 +543,22 @@ public:
 /// Logarithmicly decreasing network.
 class LogarithmicMatrixDigraph : public MatrixDigraph
 {
+  // DEFINITIONS //
+private:
+  /* Calculate twice each myColumnsCount ingress input to an egress value.
+     At most, ingress inputs occupy 16 bits, weights occupy 16 bits, myColumnsCount is 3 bits.
+     First (internal) layer values will thus occupy at most 16 + 16 + 3 = 35 bits.
+     Each extra layer will occupy at most an extra 16 (weight) + 1 (two ingress per one egress value) bits.
+  */
+  constexpr static unsigned int const ShiftCount{ 15 };
+  constexpr static DeltaBound const ShiftDivisor{ static_cast<DeltaBound>(1U SHIFT_INCREASE ShiftCount) };
+
   // INSTANCE VARIABLES //
 private:
+  // Candidate values, computed by #applyWeights.
   std::vector<Value, NoConstructAllocator<Value>> myValues;
+  // Values of the best weights so far, swapped in by #keepCandidateValues.
+  decltype(myValues) myBestValues;
 
   // DESTRUCTOR //
 public:
@@ -329,8 +584,9 @@ public:
       layerValuesCount = (1 == layerValuesCount) ? 0 : (layerValuesCount + 1) / 2;
     }
 
-    // Resize the internal values vector.
+    // Resize the internal values vectors.
     myValues.resize(valuesCount);
+    myBestValues.resize(valuesCount);
 
     // Minus the final unique sink value.
     myRequiredWeightsCount = (myInputsCount * 2) + valuesCount - 1;
@@ -348,6 +604,25 @@ protected:
   /// Use #MatrixDigraphPointer and #clone() instead.
   LogarithmicMatrixDigraph& operator=(LogarithmicMatrixDigraph const&) = delete;
 
+  // PRIVATE STATIC METHODS //
+private:
+  /// @return The values counts of the internal layers holding a weight, i.e. all but the unique sink's.
+  static std::vector<Index> internalLayersValuesCounts(Index const rowsCount)
+  {
+    std::vector<Index> layersValuesCounts;
+    // Same layers as in the constructor.
+    for (Index layerValuesCount{ rowsCount * 2 }; layerValuesCount > 1; layerValuesCount = (layerValuesCount + 1) / 2)
+      layersValuesCounts.push_back(layerValuesCount);
+    return layersValuesCounts;
+  }
+  /// @return The required weights count of a matrix digraph of rowsCount rows and columnsCount columns.
+  static std::size_t shapeRequiredWeightsCount(Index const rowsCount, Index const columnsCount)
+  {
+    auto const layersValuesCounts{ internalLayersValuesCounts(rowsCount) };
+    return (std::size_t{ rowsCount } * columnsCount * 2) +
+           std::accumulate(layersValuesCounts.cbegin(), layersValuesCounts.cend(), std::size_t{ 0 });
+  }
+
   // IMPLEMENTED INTERFACE //
 public:
   MatrixDigraphPointer clone() const override { return std::make_unique<std::decay_t<decltype(*this)>>(*this); }
@@ -378,13 +653,6 @@ public:
       myValues[egressIndex++] = result;
     }
 
-    /* Calculate twice each myColumnsCount ingress input to an egress value.
-       At most, ingress inputs occupy 16 bits, weights occupy 16 bits, myColumnsCount is 3 bits.
-       First (internal) layer values will thus occupy at most 16 + 16 + 3 = 35 bits.
-       Each extra layer will occupy at most an extra 16 (weight) + 1 (two ingress per one egress value) bits.
-    */
-    constexpr static unsigned int const ShiftCount{ 15 };
-
     ingressIndex = 0;
     /* For a 5 by 5 matrix, we would get the following, | means out of the inner loop.
        myInputsCount		5
@@ -430,4 +698,175 @@ public:
   }
 
   Value uniqueSinkValue() const noexcept(noexcept(myValues.back())) override { return myValues.back(); }
+
+  /// @return The input layer's weights region, then one region per internal layer but the unique sink's.
+  WeightsCrafter::WeightsRegions weightsRegions() const override
+  {
+    WeightsCrafter::WeightsRegions weightsRegions{ 0 };
+    Index weightsIndex{ myInputsCount * 2 };
+    // Same layers as in the constructor, each internal layer value having its own weight.
+    for (Index layerValuesCount{ (myInputsCount / myColumnsCount) * 2 }; layerValuesCount > 1;
+         layerValuesCount = (layerValuesCount + 1) / 2) {
+      weightsRegions.push_back(weightsIndex);
+      weightsIndex += layerValuesCount;
+    }
+    return weightsRegions;
+  }
+
+  /** Transfer weights trained on another rows count, but the same columns count, by linearly resampling the input
+      layer's weights row by row, and each internal layer's weights value by value. The first internal layers
+      correspond, the other ones are matched from the unique sink up.
+  */
+  bool transferWeights(WeightsCrafter::Weights const& fromWeights, WeightsCrafter::Weights& toWeights) const override
+  {
+    // Locate the rows count requiring as many weights as fromWeights.
+    Index fromRowsCount{ 2 };
+    for (; shapeRequiredWeightsCount(fromRowsCount, myColumnsCount) < fromWeights.size(); ++fromRowsCount)
+      ;
+    if (shapeRequiredWeightsCount(fromRowsCount, myColumnsCount) != fromWeights.size())
+      return false;
+    auto const toRowsCount{ myInputsCount / myColumnsCount };
+
+    toWeights.resize(myRequiredWeightsCount);
+    // Linearly interpolate the weight at toIndex among toCount from those at fromBegin among fromCount, by stride.
+    auto const resample{ [&](Index const fromBegin,
+                             Index const fromCount,
+                             Index const toBegin,
+                             Index const toCount,
+                             Index const stride) {
+      for (Index toIndex{ 0 }; toIndex != toCount; ++toIndex) {
+        auto const position{ (toCount > 1) ? ((static_cast<double>(toIndex) * (fromCount - 1)) / (toCount - 1)) : 0 };
+        auto const lowIndex{ static_cast<Index>(position) };
+        auto const highIndex{ std::min(lowIndex + 1, fromCount - 1) };
+        auto const fraction{ position - lowIndex };
+        for (Index offset{ 0 }; offset != stride; ++offset)
+          toWeights[toBegin + (toIndex * stride) + offset] = static_cast<WeightsCrafter::Weight>(
+            std::lround((fromWeights[fromBegin + (lowIndex * stride) + offset] * (1 - fraction)) +
+                        (fromWeights[fromBegin + (highIndex * stride) + offset] * fraction)));
+      }
+    } };
+
+    // Each input row has the weights of its two first internal layer values.
+    resample(0, fromRowsCount, 0, toRowsCount, myColumnsCount * 2);
+
+    auto const fromLayersValuesCounts{ internalLayersValuesCounts(fromRowsCount) };
+    auto const toLayersValuesCounts{ internalLayersValuesCounts(toRowsCount) };
+    std::vector<Index> fromLayersBegins{ fromRowsCount * myColumnsCount * 2 };
+    for (auto const layerValuesCount : fromLayersValuesCounts)
+      fromLayersBegins.push_back(fromLayersBegins.back() + layerValuesCount);
+    auto const fromLayersCount{ static_cast<Index>(fromLayersValuesCounts.size()) };
+    auto const toLayersCount{ static_cast<Index>(toLayersValuesCounts.size()) };
+    Index toLayerBegin{ myInputsCount * 2 };
+    for (Index toLayerIndex{ 0 }; toLayerIndex != toLayersCount; ++toLayerIndex) {
+      Index fromLayerIndex{ 0 };
+      if ((toLayerIndex > 0) and (fromLayersCount > 1))
+        fromLayerIndex = static_cast<Index>(
+          std::max(int64_t{ fromLayersCount } - (int64_t{ toLayersCount } - toLayerIndex), int64_t{ 1 }));
+      resample(fromLayersBegins[fromLayerIndex],
+               fromLayersValuesCounts[fromLayerIndex],
+               toLayerBegin,
+               toLayersValuesCounts[toLayerIndex],
+               1);
+      toLayerBegin += toLayersValuesCounts[toLayerIndex];
+    }
+
+    return true;
+  }
+
+  /** Follow #applyWeights node by node with, per node, four coefficients linear in the maximum input X:
+      |value| <= a X + b under both the best and current weights, and |current - best value| <= c X + d.
+      A first layer node is an exact sum of at most X × weight products.
+      A lower node decrease-shifts, which adds at most 1 to both its magnitude and its (non-zero) delta.
+  */
+  UniqueSinkValueDeltaBound uniqueSinkValueDeltaBound(std::vector<DeltaBound>& scratch) const override
+  {
+    auto const& bestWeights{ myWeightsCrafterPointer->bestWeights() };
+    auto const valuesCount{ static_cast<Index>(myValues.size()) };
+    scratch.resize(valuesCount * 4);
+    auto const a{ scratch.data() };
+    auto const b{ a + valuesCount };
+    auto const c{ b + valuesCount };
+    auto const d{ c + valuesCount };
+
+    Index weightsIndex{ 0 };
+    Index egressIndex{ 0 };
+    for (; weightsIndex != (myInputsCount * 2); ++egressIndex) {
+      DeltaBound magnitudeSum{ 0 }, deltaSum{ 0 };
+      for (auto const afterLastWeightsIndex{ weightsIndex + myColumnsCount }; weightsIndex != afterLastWeightsIndex;
+           ++weightsIndex) {
+        DeltaBound const weight{ static_cast<DeltaBound>((*myWeightsCrafterPointer)[weightsIndex]) };
+        DeltaBound const bestWeight{ static_cast<DeltaBound>(bestWeights[weightsIndex]) };
+        magnitudeSum += std::max(std::abs(weight), std::abs(bestWeight));
+        deltaSum += std::abs(weight - bestWeight);
+      }
+      a[egressIndex] = magnitudeSum;
+      b[egressIndex] = 0;
+      c[egressIndex] = deltaSum;
+      d[egressIndex] = 0;
+    }
+
+    // Accumulate one ingress node through the weight at weightsIndex into the four egress coefficients.
+    auto const accumulate{ [&](Index const ingressIndex, DeltaBound (&egress)[4]) {
+      DeltaBound const weight{ static_cast<DeltaBound>((*myWeightsCrafterPointer)[weightsIndex]) };
+      DeltaBound const bestWeight{ static_cast<DeltaBound>(bestWeights[weightsIndex]) };
+      DeltaBound const magnitude{ std::max(std::abs(weight), std::abs(bestWeight)) };
+      DeltaBound const delta{ std::abs(weight - bestWeight) };
+      DeltaBound const current{ std::abs(weight) };
+      egress[0] += a[ingressIndex] * magnitude;
+      egress[1] += b[ingressIndex] * magnitude;
+      egress[2] += (c[ingressIndex] * current) + (a[ingressIndex] * delta);
+      egress[3] += (d[ingressIndex] * current) + (b[ingressIndex] * delta);
+      ++weightsIndex;
+    } };
+    auto const store{ [&](DeltaBound (&egress)[4]) {
+      a[egressIndex] = egress[0] / ShiftDivisor;
+      b[egressIndex] = (egress[1] / ShiftDivisor) + 1;
+      c[egressIndex] = egress[2] / ShiftDivisor;
+      d[egressIndex] = egress[3] / ShiftDivisor;
+      // Unchanged ingress values and weights give the exact same egress value, else decrease-shifting adds 1.
+      if ((c[egressIndex] > 0) or (d[egressIndex] > 0))
+        ++d[egressIndex];
+      ++egressIndex;
+    } };
+
+    Index ingressIndex{ 0 };
+    for (Index ingressLastIndex{ egressIndex - 1 }; ingressIndex != ingressLastIndex;
+         ingressLastIndex = egressIndex - 1) {
+      for (; ingressIndex < ingressLastIndex; ingressIndex += 2) {
+        DeltaBound egress[4]{ 0, 0, 0, 0 };
+        accumulate(ingressIndex, egress);
+        accumulate(ingressIndex + 1, egress);
+        store(egress);
+      }
+      if (ingressIndex == ingressLastIndex) {
+        DeltaBound egress[4]{ 0, 0, 0, 0 };
+        accumulate(ingressIndex++, egress);
+        store(egress);
+      }
+    }
+
+    return { c[valuesCount - 1], d[valuesCount - 1] };
+  }
+
+  /// The candidate values become the best values in O(1). The previous best values become the next scratch values.
+  void keepCandidateValues() noexcept override { myValues.swap(myBestValues); }
+  Value bestUniqueSinkValue() const noexcept(noexcept(myBestValues.back())) override { return myBestValues.back(); }
 };
+
+/*
+****************
+** PROCEDURES **
+****************
+*/
+
+/// @return The weights crafters selectable at run time by name, the first one by default.
+static decltype(auto)
+NaiveWeightsCraftersMap()
+{
+  return SupervisedNetworkTrainer::WeightsCraftersMap{
+    { "GeometricWeightsCrafter",
+      [](auto weightsCount) { return std::make_shared<GeometricWeightsCrafter>(weightsCount); } },
+    { "ImportanceWeightsCrafter",
+      [](auto weightsCount) { return std::make_shared<GeometricWeightsCrafter>(weightsCount, true); } }
+  };
+}
@@ -32,8 +32,12 @@
 **************
 */
 
+#include <algorithm>
+#include <cmath>
 #include <csignal>
+#include <functional>
 #include <map>
+#include <numeric>
 
 #include "Utilities.hpp"
 
@@ -58,9 +62,14 @@ class WeightsCrafter
   // DEFINITIONS //
 public:
   using Weight = int16_t;
+  using Weights = std::vector<Weight, NoConstructAllocator<Weight>>;
   using WeightsCrafterPointer = std::shared_ptr<WeightsCrafter>;
   using ConstWeightsCrafterPointer = std::shared_ptr<WeightsCrafter const>;
   using WeightsCrafterInstantiator = std::function<WeightsCrafterPointer(Index const weightsCount)>;
+  /// Ascending first weights indexes of contiguous regions of weights with similar effects, starting with 0.
+  using WeightsRegions = std::vector<Index>;
+  /// Transfer weights of another count into weights of the required count. @return False if not transferable.
+  using WeightsTransferer = std::function<bool(Weights const& fromWeights, Weights& toWeights)>;
 
 protected:
   using WeightCalculator = int32_t;
@@ -73,20 +82,37 @@ protected:
   std::shared_ptr<std::mt19937_64> myRandomIntegerPointer;
   RandomBoolean<decltype(myRandomIntegerPointer)> myRandomBoolean;
   Index myWeightsCount;
-  std::vector<Weight, NoConstructAllocator<Weight>> myWeights;
+  Weights myWeights;
 
   // DESTRUCTOR //
 public:
   // Base class.
   virtual ~WeightsCrafter() = default;
 
+  // PRIVATE STATIC METHODS //
+private:
+  /// Origin of the seeds, 0 to seed from the current time, and count of the seeds drawn since set.
+  static auto& seeds() noexcept
+  {
+    static struct
+    {
+      std::atomic<uint64_t> origin{ 0 };
+      std::atomic<uint64_t> count{ 0 };
+    } seeds;
+    return seeds;
+  }
+
   // PRIVATE INSTANCE METHODS //
 private:
   decltype(auto) currentTimeSeed() const
     noexcept(noexcept(std::chrono::high_resolution_clock::now().time_since_epoch().count()))
   {
+    auto const seedsOrigin{ seeds().origin.load() };
+    // Distinct seeds even for weights crafters created within the clock's resolution.
     return static_cast<std::decay_t<decltype(*myRandomIntegerPointer)>::result_type>(
-      std::chrono::high_resolution_clock::now().time_since_epoch().count());
+      (seedsOrigin ? seedsOrigin
+                   : static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())) +
+      (seeds().count++ * 0x9E3779B97F4A7C15));
   }
 
   // CONSTRUCTORS //
@@ -121,17 +147,50 @@ protected:
   /// Use #WeightsCrafterPointer, #ConstWeightsCrafterPointer and #clone() instead.
   WeightsCrafter& operator=(WeightsCrafter&&) = delete;
 
+  // PUBLIC STATIC METHODS //
+public:
+  /** Seed the weights crafters created or re-seeded from now on, in order, from seedsOrigin instead of the current
+      time, so that their training can be reproduced. 0 seeds them from the current time again.
+  */
+  static void seedFrom(uint64_t const seedsOrigin) noexcept
+  {
+    seeds().origin = seedsOrigin;
+    seeds().count = 0;
+  }
+
   // PUBLIC INSTANCE METHODS //
 public:
   void reSeedRandomVariable() { myRandomIntegerPointer->seed(currentTimeSeed()); }
 
-  /// @return True on success, else false, and log error.
-  bool readWeightsFromFile(Logger& logger, decltype(OpenInputBinaryFileNamed(""))& weightsFileStatus)
+  /** @param[in] weightsTransferer If callable, transfers the weights of a weights file of another size.
+      @return True on success, else false, and log error.
+  */
+  bool readWeightsFromFile(Logger& logger,
+                           decltype(OpenInputBinaryFileNamed(""))& weightsFileStatus,
+                           WeightsTransferer const& weightsTransferer = nullptr)
   {
     auto& [weightsFile, errorMessage, weightsFileSize]{ weightsFileStatus };
 
     // Validate that the weights file is the right size.
     auto const requiredWeightsFileSize{ static_cast<decltype(weightsFileSize)>(myWeightsCount * sizeof(myWeights[0])) };
+    if ((weightsFileSize != requiredWeightsFileSize) and weightsTransferer and (weightsFileSize > 0) and
+        ((weightsFileSize % static_cast<decltype(weightsFileSize)>(sizeof(myWeights[0]))) == 0)) {
+      // Load the weights file's weights, then transfer them.
+      Weights fileWeights(static_cast<std::size_t>(weightsFileSize) / sizeof(myWeights[0]));
+      weightsFile.read(reinterpret_cast<decltype(weightsFile)::char_type*>(fileWeights.data()), weightsFileSize);
+      if (not weightsFile.good()) {
+        logger.streamCondition(weightsFile) << "Reading weights file.\n\n";
+        return false;
+      }
+      if (weightsTransferer(fileWeights, myWeights)) {
+        logger << fileWeights.size() << " weights were loaded and transferred into " << myWeightsCount
+               << " weights.\n";
+        return true;
+      }
+      logger.error() << "The " << fileWeights.size() << " weights of the weights file can not be transferred into "
+                     << myWeightsCount << " weights.\n\n";
+      return false;
+    }
     if (weightsFileSize != requiredWeightsFileSize) {
       logger.error();
       logger << "Weights file is of size " << weightsFileSize << " bytes but must be of size "
@@ -191,6 +250,7 @@ public:
 
   decltype(auto) weightsCount() const noexcept { return myWeightsCount; }
   decltype(auto) operator[](Index const index) const noexcept(noexcept(myWeights[index])) { return myWeights[index]; }
+  auto const& weights() const noexcept { return myWeights; }
 
   // ABSTRACT INTERFACE //
 
@@ -211,9 +271,14 @@ public:
       may have deteriorated them.
   */
   virtual void bringBackBestWeights() = 0;
+  /// @return The best weights so far, i.e. those #bringBackBestWeights brings back.
+  virtual Weights const& bestWeights() const = 0;
 
   /// Log useful informations about the current state.
   virtual void logCurrentState(Logger& logger) const = 0;
+
+  /// Optionally use weightsRegions to alter the weights of each region differently. Ignored by default.
+  virtual void setWeightsRegions(WeightsRegions const& weightsRegions) { static_cast<void>(weightsRegions); }
 };
 
 /*
@@ -238,6 +303,14 @@ public:
   using Input = uint16_t;
   using Value = int64_t;
 
+  using DeltaBound = double;
+  /// |current unique sink value - best unique sink value| <= perMaximumInput × #maximumInput + constant.
+  struct UniqueSinkValueDeltaBound
+  {
+    DeltaBound perMaximumInput;
+    DeltaBound constant;
+  };
+
   // INSTANCE VARIABLES //
 protected:
   Index myRequiredWeightsCount{ 0 };
@@ -245,6 +318,7 @@ protected:
   Index myColumnsCount;
   Index myInputsCount;
   std::vector<Input, NoConstructAllocator<Input>> myInputs;
+  Input myMaximumInput{ 0 };
   WeightsCrafter::ConstWeightsCrafterPointer myWeightsCrafterPointer;
 
   // DESTRUCTOR //
@@ -291,18 +365,52 @@ public:
   void setName(decltype(myName) const& name) noexcept(noexcept(myName = name)) { myName = name; }
   auto const& name() const noexcept { return myName; }
 
+  /// @return The largest input, as read by #readInputsFromStream or #readSelectedInputsFromStream.
+  decltype(auto) maximumInput() const noexcept { return myMaximumInput; }
+
   /// @return True on success, else false, and log error.
   bool readInputsFromStream(Logger& logger, std::istream& inputsStream)
   {
     inputsStream.read(reinterpret_cast<std::decay_t<decltype(inputsStream)>::char_type*>(myInputs.data()),
                       static_cast<std::streamsize>(myInputsCount * sizeof(myInputs[0])));
-    if (inputsStream.good())
+    if (inputsStream.good()) {
+      myMaximumInput = *std::max_element(myInputs.cbegin(), myInputs.cend());
       return true;
-    else {
+    } else {
       logger.streamCondition(inputsStream) << "Reading the inputs stream into Matrix digraph '" << myName << "'.\n\n";
       return false;
     }
   }
+  /** Read whole rows of streamColumnsCount columns into streamInputs, then gather only the columns at columnIndexes.
+      @param[in] columnIndexes Holds exactly myColumnsCount column indexes, each < streamColumnsCount.
+      @param[in] streamInputs Scratch buffer of at least (rows count × streamColumnsCount) inputs, reused by the caller.
+      @return True on success, else false, and log error.
+  */
+  template<typename Indexes, typename Inputs>
+  bool readSelectedInputsFromStream(Logger& logger,
+                                    std::istream& inputsStream,
+                                    Index const streamColumnsCount,
+                                    Indexes const& columnIndexes,
+                                    Inputs& streamInputs)
+  {
+    auto const rowsCount{ myInputsCount / myColumnsCount };
+    inputsStream.read(reinterpret_cast<std::decay_t<decltype(inputsStream)>::char_type*>(streamInputs.data()),
+                      static_cast<std::streamsize>(rowsCount * streamColumnsCount * sizeof(myInputs[0])));
+    if (not inputsStream.good()) {
+      logger.streamCondition(inputsStream) << "Reading the inputs stream into Matrix digraph '" << myName << "'.\n\n";
+      return false;
+    }
+
+    // Strided gather of the selected columns, row by row.
+    auto streamRow{ streamInputs.data() };
+    auto input{ myInputs.data() };
+    for (Index row{ 0 }; row != rowsCount; ++row, streamRow += streamColumnsCount)
+      for (auto const columnIndex : columnIndexes)
+        *input++ = streamRow[columnIndex];
+    myMaximumInput = *std::max_element(myInputs.cbegin(), myInputs.cend());
+
+    return true;
+  }
 
   void useWeightsCrafter(decltype(myWeightsCrafterPointer) const& weightsCrafterPointer)
   {
@@ -331,8 +439,38 @@ public:
      MatrixDigraphPointer clone() const override { return std::make_unique<std::decay_t<decltype(*this)>>(*this); }
   */
 
+  /// Compute the candidate values from the weights crafter's current weights.
   virtual void applyWeights() = 0;
+  /// @return The candidate unique sink value, as computed by the last #applyWeights.
   virtual Value uniqueSinkValue() const = 0;
+
+  /** The candidate values (from the last #applyWeights) become the best values.
+      Rejecting the candidate values needs nothing as the next #applyWeights overwrites them.
+  */
+  virtual void keepCandidateValues() = 0;
+  /// @return The unique sink value of the last kept candidate values.
+  virtual Value bestUniqueSinkValue() const = 0;
+
+  /** Bound how far the unique sink value computed from the weights crafter's current weights may be from
+      #bestUniqueSinkValue, computed from its best weights. The bound only depends on the weights and #maximumInput,
+      so it is computed once for ALL the matrix digraphs of the same shape.
+      @param[in] scratch Reusable scratch vector.
+  */
+  virtual UniqueSinkValueDeltaBound uniqueSinkValueDeltaBound(std::vector<DeltaBound>& scratch) const = 0;
+
+  /// @return The regions of the required weights, e.g. per layer. A single region by default.
+  virtual WeightsCrafter::WeightsRegions weightsRegions() const { return { 0 }; }
+
+  /** Transfer fromWeights, required by a matrix digraph of the same type but of another shape, into toWeights,
+      resized to the required weights count, e.g. to warm-start from the weights trained on another rows count.
+      @return False if fromWeights can not be transferred, the default.
+  */
+  virtual bool transferWeights(WeightsCrafter::Weights const& fromWeights, WeightsCrafter::Weights& toWeights) const
+  {
+    static_cast<void>(fromWeights);
+    static_cast<void>(toWeights);
+    return false;
+  }
 };
 
 /*
@@ -345,6 +483,12 @@ public:
 class SupervisedNetworkEvent
 {
   // DEFINITIONS //
+public:
+  /* Cap of each matrix digraph's normalized lead over the desired one in the margins, so that those leading by far
+     can still be pruned. Arbitrarily determined.
+  */
+  constexpr static double const MaximumNormalizedLead{ 1.0 / 1024 };
+
 private:
   using FileHeaderDatum = uint32_t;
 
@@ -355,6 +499,36 @@ private:
   std::vector<MatrixDigraph::MatrixDigraphPointer> myMatrixDigraphPointers;
   Index myDesiredMatrixDigraphIndex;
   std::string myDesiredMatrixName;
+  // Snapshot of each matrix digraph's best unique sink value, taken by #keepCandidateValues.
+  std::vector<MatrixDigraph::Value> myBestUniqueSinkValues;
+  // Snapshot of each matrix digraph's maximum input, for the unique sink value bounds.
+  std::vector<MatrixDigraph::DeltaBound> myMaximumInputs;
+  // Matrix digraphs that #applyWeightsToRank did not evaluate. Not std::vector<bool> to be written concurrently.
+  std::vector<uint8_t> myCandidateValuesAreStale;
+  std::vector<MatrixDigraph::DeltaBound> myDeltaBoundScratch;
+  // Computed by #prepareToRank.
+  MatrixDigraph::Value myDesiredUniqueSinkValue{ 0 };
+  MatrixDigraph::UniqueSinkValueDeltaBound myDeltaBound{ 0, 0 };
+  // Contiguous ranges of matrix digraphs, each written to by one gofer thread only.
+  struct ALIGN_CACHE_FRIENDLY Chunk
+  {
+    Index beginIndex;
+    Index endIndex;
+    Index rank;
+    double margin;
+    // Accumulated by #applyWeightsToRankChunk.
+    uint64_t evaluatedCount;
+    uint64_t prunedCount;
+  };
+  std::vector<Chunk> myChunks;
+  Index myCandidateRank{ 0 };
+  // Ranks are capped at this, see #setRankCap.
+  Index myRankCap{ InvalidIndex };
+  // Factor of this event's rank in the ranks total, see #setRankWeight.
+  Index myRankWeight{ 1 };
+  // Whether #applyWeightsToRankChunk also sums the margins, see #candidateMargin.
+  bool myMarginsAreComputed{ false };
+  double myCandidateMargin{ 0 };
 
   // DESTRUCTOR //
 public:
@@ -365,8 +539,23 @@ public:
 public:
   SupervisedNetworkEvent() { clearMatrixDigraphs(); }
 
-  // Disabled for now as needs deep copying.
-  SupervisedNetworkEvent(SupervisedNetworkEvent const&) = delete;
+  /// Deep copy, cloning the matrix digraphs. Assign a weights crafter to the copy with #useWeightsCrafter.
+  SupervisedNetworkEvent(SupervisedNetworkEvent const& other)
+    : myName(other.myName)
+    , myDesiredMatrixDigraphIndex(other.myDesiredMatrixDigraphIndex)
+    , myDesiredMatrixName(other.myDesiredMatrixName)
+    , myBestUniqueSinkValues(other.myBestUniqueSinkValues)
+    , myMaximumInputs(other.myMaximumInputs)
+    , myCandidateValuesAreStale(other.myCandidateValuesAreStale)
+    , myChunks(other.myChunks)
+    , myRankCap(other.myRankCap)
+    , myRankWeight(other.myRankWeight)
+    , myMarginsAreComputed(other.myMarginsAreComputed)
+  {
+    myMatrixDigraphPointers.reserve(other.myMatrixDigraphPointers.size());
+    for (auto const& matrixDigraphPointer : other.myMatrixDigraphPointers)
+      myMatrixDigraphPointers.push_back(matrixDigraphPointer->clone());
+  }
 
   SupervisedNetworkEvent(SupervisedNetworkEvent&&) = default;
 
@@ -376,11 +565,41 @@ public:
 
   SupervisedNetworkEvent& operator=(SupervisedNetworkEvent&&) = default;
 
+  // PRIVATE STATIC METHODS //
+private:
+  /** @return How much uniqueSinkValue leads desiredUniqueSinkValue, normalized to [0, 1) if it is not below it,
+      and growing with uniqueSinkValue.
+  */
+  static double normalizedLead(MatrixDigraph::DeltaBound const uniqueSinkValue,
+                               MatrixDigraph::DeltaBound const desiredUniqueSinkValue) noexcept
+  {
+    return (uniqueSinkValue - desiredUniqueSinkValue) /
+           (std::abs(uniqueSinkValue) + std::abs(desiredUniqueSinkValue) + 1);
+  }
+  /// @return The contribution to the margins of a matrix digraph ranking above the desired one.
+  static double cappedNormalizedLead(MatrixDigraph::Value const uniqueSinkValue,
+                                     MatrixDigraph::Value const desiredUniqueSinkValue) noexcept
+  {
+    return std::min(normalizedLead(static_cast<MatrixDigraph::DeltaBound>(uniqueSinkValue),
+                                   static_cast<MatrixDigraph::DeltaBound>(desiredUniqueSinkValue)),
+                    MaximumNormalizedLead);
+  }
+
+  // PRIVATE INSTANCE METHODS //
+private:
+  /// @return The margin of an event whose rank reached the cap, the largest one an uncapped rank could have.
+  double cappedRankMargin() const noexcept { return (myRankCap - 1) * MaximumNormalizedLead; }
+
   // PUBLIC INSTANCE METHODS //
 public:
-  void clearMatrixDigraphs() noexcept(noexcept(myMatrixDigraphPointers.clear()))
+  void clearMatrixDigraphs() noexcept(noexcept(myMatrixDigraphPointers.clear()) and
+                                      noexcept(myBestUniqueSinkValues.clear()))
   {
     myMatrixDigraphPointers.clear();
+    myBestUniqueSinkValues.clear();
+    myMaximumInputs.clear();
+    myCandidateValuesAreStale.clear();
+    myChunks.clear();
     myDesiredMatrixDigraphIndex = InvalidIndex;
   }
 
@@ -399,19 +618,26 @@ public:
 
   auto const& desiredMatrixName() const noexcept { return myDesiredMatrixName; }
 
-  /// @return True on success, else false, and log error. Throw an exceptions on error.
+  /** @param[in] columnIndexes Indexes of the event file's columns to keep, in order. Empty to keep them all.
+      @return True on success, else false, and log error. Throw an exceptions on error.
+  */
   bool buildMatrixDigraphs(Logger& logger,
                            std::string const& desiredMatrixName,
                            decltype(OpenInputBinaryFileNamed(""))& eventFileStatus,
-                           MatrixDigraph::MatrixDigraphInstantiator const& matrixDigraphInstantiator)
+                           MatrixDigraph::MatrixDigraphInstantiator const& matrixDigraphInstantiator,
+                           std::vector<Index> const& columnIndexes = {})
   {
-    return buildMatrixDigraphs(logger, std::string(desiredMatrixName), eventFileStatus, matrixDigraphInstantiator);
+    return buildMatrixDigraphs(
+      logger, std::string(desiredMatrixName), eventFileStatus, matrixDigraphInstantiator, columnIndexes);
   }
-  /// @return True on success, else false, and log error. Throw an exceptions on error.
+  /** @param[in] columnIndexes Indexes of the event file's columns to keep, in order. Empty to keep them all.
+      @return True on success, else false, and log error. Throw an exceptions on error.
+  */
   bool buildMatrixDigraphs(Logger& logger,
                            std::string&& desiredMatrixName,
                            decltype(OpenInputBinaryFileNamed(""))& eventFileStatus,
-                           MatrixDigraph::MatrixDigraphInstantiator const& matrixDigraphInstantiator)
+                           MatrixDigraph::MatrixDigraphInstantiator const& matrixDigraphInstantiator,
+                           std::vector<Index> const& columnIndexes = {})
   {
     // Check if matrixDigraphInstantiator is callable.
     if (not matrixDigraphInstantiator)
@@ -476,11 +702,29 @@ public:
       return false;
     }
 
+    // Validate the selected columns, if any.
+    for (auto const columnIndex : columnIndexes)
+      if (columnIndex >= eventFileHeader.matrixColumnsCount) {
+        logger.error() << "Selected column " << columnIndex << " is not less than the matrix columns count "
+                       << eventFileHeader.matrixColumnsCount << ".\n\n";
+        return false;
+      }
+    bool const selectColumns{ not columnIndexes.empty() };
+    auto const columnsCount{ selectColumns ? static_cast<Index>(columnIndexes.size())
+                                           : static_cast<Index>(eventFileHeader.matrixColumnsCount) };
+    // Scratch buffer holding one whole matrix as stored in the event file, only needed to select columns.
+    std::vector<MatrixDigraph::Input, NoConstructAllocator<MatrixDigraph::Input>> matrixInputs(
+      selectColumns ? (eventFileHeader.matrixRowsCount * eventFileHeader.matrixColumnsCount) : 0);
+
     // Char vector to extract the matrix names.
     std::vector<char> matrixNameCString((eventFileHeader.matrixNameSize + 1), 0);
 
     // Build all the matrix digraphs.
     myMatrixDigraphPointers.resize(eventFileHeader.matricesCount);
+    myBestUniqueSinkValues.resize(eventFileHeader.matricesCount);
+    myMaximumInputs.resize(eventFileHeader.matricesCount);
+    myCandidateValuesAreStale.assign(eventFileHeader.matricesCount, 0);
+    splitIntoChunks(1);
     for (Index index{ 0 }; index != eventFileHeader.matricesCount; ++index) {
       // Extract the matrix name.
       eventFile.read(matrixNameCString.data(), eventFileHeader.matrixNameSize);
@@ -491,12 +735,16 @@ public:
 
       std::decay_t<decltype(myMatrixDigraphPointers[index]->name())> matrixName(matrixNameCString.data());
       // Instantiate the next matrix digraph.
-      if ((myMatrixDigraphPointers[index] =
-             matrixDigraphInstantiator(eventFileHeader.matrixRowsCount, eventFileHeader.matrixColumnsCount))) {
+      if ((myMatrixDigraphPointers[index] = matrixDigraphInstantiator(eventFileHeader.matrixRowsCount, columnsCount))) {
 
         // Populate the matrix digraph just created.
-        if (not myMatrixDigraphPointers[index]->readInputsFromStream(logger, eventFile))
+        if (selectColumns) {
+          if (not myMatrixDigraphPointers[index]->readSelectedInputsFromStream(
+                logger, eventFile, eventFileHeader.matrixColumnsCount, columnIndexes, matrixInputs))
+            return false;
+        } else if (not myMatrixDigraphPointers[index]->readInputsFromStream(logger, eventFile))
           return false;
+        myMaximumInputs[index] = myMatrixDigraphPointers[index]->maximumInput();
         myMatrixDigraphPointers[index]->setName(std::move(matrixName));
 
         // Try to locate the desired iputs matrix name.
@@ -522,8 +770,10 @@ public:
     }
 
     logger << "    ◦ Created " << eventFileHeader.matricesCount << " matrix digraphs of "
-           << eventFileHeader.matrixRowsCount << " rows by " << eventFileHeader.matrixColumnsCount
-           << " columns, and requiring " << requiredWeightsCount() << " weights.\n";
+           << eventFileHeader.matrixRowsCount << " rows by " << columnsCount;
+    if (selectColumns)
+      logger << " (of " << eventFileHeader.matrixColumnsCount << ')';
+    logger << " columns, and requiring " << requiredWeightsCount() << " weights.\n";
 
     return true;
   }
@@ -541,6 +791,16 @@ public:
 
     return weightsCount;
   }
+  /// @return The weights regions of the first matrix digraph, as all share the same required weights count.
+  WeightsCrafter::WeightsRegions weightsRegions() const
+  {
+    return empty() ? WeightsCrafter::WeightsRegions{ 0 } : myMatrixDigraphPointers[0]->weightsRegions();
+  }
+  /// @return False if there is no matrix digraph, else as MatrixDigraph#transferWeights for all of them.
+  bool transferWeights(WeightsCrafter::Weights const& fromWeights, WeightsCrafter::Weights& toWeights) const
+  {
+    return (not empty()) and myMatrixDigraphPointers[0]->transferWeights(fromWeights, toWeights);
+  }
   void useWeightsCrafter(WeightsCrafter::ConstWeightsCrafterPointer const& weightsCrafterPointer) const
   {
     for (auto&& matrixDigraphPointer : myMatrixDigraphPointers)
@@ -565,45 +825,268 @@ public:
   /** @pre #canApplyWeights MUST ABSOLUTELY return TRUE before #applyWeights is called.
       For performance, not doing so may result in undefined behaviour.
   */
-  void applyWeights() const noexcept(noexcept(myMatrixDigraphPointers[0]->applyWeights()))
+  void applyWeights() noexcept(noexcept(myMatrixDigraphPointers[0]->applyWeights()))
   {
     for (auto&& matrixDigraphPointer : myMatrixDigraphPointers)
       matrixDigraphPointer->applyWeights();
+    std::fill(myCandidateValuesAreStale.begin(), myCandidateValuesAreStale.end(), 0);
+  }
+
+  /** Split the matrix digraphs into chunksCount contiguous ranges of (almost) equal sizes, to be ranked and kept
+      concurrently by #applyWeightsToRankChunk and #keepCandidateValuesChunk.
+  */
+  void splitIntoChunks(Index chunksCount)
+  {
+    auto const matrixDigraphsCount{ static_cast<Index>(myMatrixDigraphPointers.size()) };
+    if (chunksCount > matrixDigraphsCount)
+      chunksCount = matrixDigraphsCount;
+    if (chunksCount < 1)
+      chunksCount = 1;
+
+    myChunks.resize(chunksCount);
+    for (Index chunkIndex{ 0 }; chunkIndex != chunksCount; ++chunkIndex) {
+      myChunks[chunkIndex].beginIndex =
+        static_cast<Index>((uint64_t{ matrixDigraphsCount } * chunkIndex) / chunksCount);
+      myChunks[chunkIndex].endIndex =
+        static_cast<Index>((uint64_t{ matrixDigraphsCount } * (chunkIndex + 1)) / chunksCount);
+    }
+  }
+  decltype(auto) chunksCount() const noexcept { return static_cast<Index>(myChunks.size()); }
+
+  /** First step of ranking: evaluate the desired matrix digraph and the unique sink value delta bound.
+      @pre #canApplyWeights MUST ABSOLUTELY return TRUE, and the best values MUST be those of the weights crafter's
+      best weights, i.e. #keepCandidateValues was called after each improvement.
+  */
+  void prepareToRank()
+  {
+    if (myDesiredMatrixDigraphIndex == InvalidIndex)
+      return;
+
+    auto const& desiredMatrixDigraphPointer{ myMatrixDigraphPointers[myDesiredMatrixDigraphIndex] };
+    desiredMatrixDigraphPointer->applyWeights();
+    myDesiredUniqueSinkValue = desiredMatrixDigraphPointer->uniqueSinkValue();
+    myDeltaBound = desiredMatrixDigraphPointer->uniqueSinkValueDeltaBound(myDeltaBoundScratch);
+  }
+  /** Second step of ranking, chunks may run concurrently: count the chunk's matrix digraphs whose unique sink value
+      is >= the desired one's, evaluating exactly only those whose bounds straddle the desired one's.
+      The others are surely above or below it, but when computing the margins, those surely above are evaluated too
+      unless their capped normalized leads are surely maximal. Stop counting once the rank cap is reached,
+      as the event's rank is then decided.
+      @pre #prepareToRank was called since the weights last changed.
+  */
+  void applyWeightsToRankChunk(Index const chunkIndex)
+  {
+    auto& chunk{ myChunks[chunkIndex] };
+    chunk.rank = 0;
+    chunk.margin = 0;
+    if (myDesiredMatrixDigraphIndex == InvalidIndex)
+      return;
+
+    auto const desiredDeltaBound{ static_cast<MatrixDigraph::DeltaBound>(myDesiredUniqueSinkValue) };
+    auto const [perMaximumInput, constant]{ myDeltaBound };
+
+    Index rank{ 0 };
+    double margin{ 0 };
+    uint64_t evaluatedCount{ 0 };
+    Index index{ chunk.beginIndex };
+    for (; (index != chunk.endIndex) and (rank < myRankCap); ++index) {
+      if (index == myDesiredMatrixDigraphIndex) {
+        myCandidateValuesAreStale[index] = 0;
+        ++rank;
+        ++evaluatedCount;
+        continue;
+      }
+
+      // Widened by a relative epsilon against the floating point rounding of the bound.
+      auto const deltaBound{ ((perMaximumInput * myMaximumInputs[index]) + constant) * (1 + 1e-9) + 1 };
+      auto const bestUniqueSinkValue{ static_cast<MatrixDigraph::DeltaBound>(myBestUniqueSinkValues[index]) };
+      if (auto const lowestUniqueSinkValue{ bestUniqueSinkValue - deltaBound };
+          (lowestUniqueSinkValue >= desiredDeltaBound) and
+          ((not myMarginsAreComputed) or
+           (normalizedLead(lowestUniqueSinkValue, desiredDeltaBound) >= MaximumNormalizedLead))) {
+        // Surely above, by far enough if computing the margins.
+        myCandidateValuesAreStale[index] = 1;
+        ++rank;
+        if (myMarginsAreComputed)
+          margin += MaximumNormalizedLead;
+      } else if ((bestUniqueSinkValue + deltaBound) < desiredDeltaBound)
+        // Surely below.
+        myCandidateValuesAreStale[index] = 1;
+      else {
+        // Straddling, so evaluate exactly.
+        myCandidateValuesAreStale[index] = 0;
+        myMatrixDigraphPointers[index]->applyWeights();
+        if (auto const uniqueSinkValue{ myMatrixDigraphPointers[index]->uniqueSinkValue() };
+            uniqueSinkValue >= myDesiredUniqueSinkValue) {
+          ++rank;
+          if (myMarginsAreComputed)
+            margin += cappedNormalizedLead(uniqueSinkValue, myDesiredUniqueSinkValue);
+        }
+        ++evaluatedCount;
+      }
+    }
+    // The matrix digraphs left uncounted once the rank cap was reached.
+    std::fill(myCandidateValuesAreStale.begin() + index, myCandidateValuesAreStale.begin() + chunk.endIndex, 1);
+
+    chunk.rank = rank;
+    chunk.margin = margin;
+    chunk.evaluatedCount += evaluatedCount;
+    chunk.prunedCount += (chunk.endIndex - chunk.beginIndex) - evaluatedCount;
+  }
+  /// Last step of ranking: sum the chunks' ranks and margins into #candidateRank and #candidateMargin.
+  void reduceCandidateRank() noexcept
+  {
+    myCandidateRank = 0;
+    myCandidateMargin = 0;
+    for (auto const& chunk : myChunks) {
+      myCandidateRank += chunk.rank;
+      myCandidateMargin += chunk.margin;
+    }
+    if (myCandidateRank >= myRankCap) {
+      myCandidateRank = myRankCap;
+      if (myMarginsAreComputed)
+        myCandidateMargin = cappedRankMargin();
+    }
+  }
+  /// #prepareToRank, #applyWeightsToRankChunk on all chunks, then #reduceCandidateRank, on the current thread.
+  void applyWeightsToRank()
+  {
+    prepareToRank();
+    for (Index chunkIndex{ 0 }; chunkIndex != chunksCount(); ++chunkIndex)
+      applyWeightsToRankChunk(chunkIndex);
+    reduceCandidateRank();
+  }
+  /// @return The desired matrix digraph's rank computed by the last #applyWeightsToRank or #reduceCandidateRank.
+  decltype(auto) candidateRank() const noexcept { return myCandidateRank; }
+
+  /** Cap the ranks at rankCap, so that all the ranks beyond rankCap - 1 count the same and ranking stops counting
+      once the cap is reached. InvalidIndex for no cap.
+  */
+  void setRankCap(Index const rankCap)
+  {
+    if (rankCap < 1)
+      throw std::logic_error(String(+"rankCap is 0 in: ", +__PRETTY_FUNCTION__, '.'));
+    myRankCap = rankCap;
+  }
+  decltype(auto) rankCap() const noexcept { return myRankCap; }
+  /// Count this event's rank, and margin, rankWeight times in the totals.
+  void setRankWeight(Index const rankWeight)
+  {
+    if (rankWeight < 1)
+      throw std::logic_error(String(+"rankWeight is 0 in: ", +__PRETTY_FUNCTION__, '.'));
+    myRankWeight = rankWeight;
+  }
+  decltype(auto) rankWeight() const noexcept { return myRankWeight; }
+
+  /** Also compute, or not, the margin by which the matrix digraphs ranking above the desired one lead it, as a finer
+      grained objective than the rank. The matrix digraphs surely above it are then only pruned when their lead is
+      surely capped at MaximumNormalizedLead.
+  */
+  void computeMargins(bool const marginsAreComputed) noexcept { myMarginsAreComputed = marginsAreComputed; }
+  decltype(auto) marginsAreComputed() const noexcept { return myMarginsAreComputed; }
+  /** @return The sum, over the matrix digraphs ranking above the desired one, of their normalized leads over it
+      capped at MaximumNormalizedLead, computed by the last #applyWeightsToRank or #reduceCandidateRank
+      if #computeMargins.
+  */
+  decltype(auto) candidateMargin() const noexcept { return myCandidateMargin; }
+  /// @return The accumulated {evaluated, pruned} matrix digraphs counts of #applyWeightsToRankChunk, then reset them.
+  std::pair<uint64_t, uint64_t> takeEvaluatedAndPrunedCounts() noexcept
+  {
+    std::pair<uint64_t, uint64_t> counts{ 0, 0 };
+    for (auto&& chunk : myChunks) {
+      counts.first += chunk.evaluatedCount;
+      counts.second += chunk.prunedCount;
+      chunk.evaluatedCount = chunk.prunedCount = 0;
+    }
+    return counts;
+  }
+
+  /** The chunk's matrix digraphs' candidate values become their best values, and snapshot their unique sink values.
+      Chunks may run concurrently. Matrix digraphs pruned by #applyWeightsToRankChunk are evaluated first,
+      so the weights MUST NOT have changed since.
+  */
+  void keepCandidateValuesChunk(Index const chunkIndex) noexcept(
+    noexcept(myMatrixDigraphPointers[0]->applyWeights()) and
+    noexcept(myMatrixDigraphPointers[0]->keepCandidateValues()) and
+    noexcept(myMatrixDigraphPointers[0]->bestUniqueSinkValue()))
+  {
+    auto const& chunk{ myChunks[chunkIndex] };
+    for (Index index{ chunk.beginIndex }; index != chunk.endIndex; ++index) {
+      auto const& matrixDigraphPointer{ myMatrixDigraphPointers[index] };
+      if (myCandidateValuesAreStale[index]) {
+        matrixDigraphPointer->applyWeights();
+        myCandidateValuesAreStale[index] = 0;
+      }
+      matrixDigraphPointer->keepCandidateValues();
+      myBestUniqueSinkValues[index] = matrixDigraphPointer->bestUniqueSinkValue();
+    }
+  }
+  /** All the matrix digraphs' candidate values become their best values, and snapshot their unique sink values.
+      Rejecting the candidate values needs nothing as the next #applyWeights overwrites them.
+  */
+  void keepCandidateValues() noexcept(noexcept(keepCandidateValuesChunk(0)))
+  {
+    for (Index chunkIndex{ 0 }; chunkIndex != chunksCount(); ++chunkIndex)
+      keepCandidateValuesChunk(chunkIndex);
   }
+  /// @return The best unique sink values snapshot, in the same order as the matrix digraphs.
+  auto const& bestUniqueSinkValues() const noexcept { return myBestUniqueSinkValues; }
 
-  /// @return 0 if there is no desired matrix digraph.
-  decltype(auto) desiredMatrixDigraphRank() const noexcept(noexcept(myMatrixDigraphPointers[0]->uniqueSinkValue()))
+  /// @return The capped rank from the best unique sink values snapshot, 0 if there is no desired matrix digraph.
+  Index bestDesiredMatrixDigraphRank() const noexcept
   {
     Index rank{ 0 };
 
     if (myDesiredMatrixDigraphIndex == InvalidIndex)
       return rank;
 
-    auto const desiredMatrixDigraphUniqueSinkValue{
-      myMatrixDigraphPointers[myDesiredMatrixDigraphIndex]->uniqueSinkValue()
-    };
-    // Count how many matrix network's output values (including de desired one's) is >= than the
-    // desired one's.
-    for (auto const& matrixDigraphPointer : myMatrixDigraphPointers)
-      if (matrixDigraphPointer->uniqueSinkValue() >= desiredMatrixDigraphUniqueSinkValue)
+    auto const desiredMatrixDigraphUniqueSinkValue{ myBestUniqueSinkValues[myDesiredMatrixDigraphIndex] };
+    // Count how many matrix network's output values (including de desired one's) is >= than the desired one's.
+    for (auto const bestUniqueSinkValue : myBestUniqueSinkValues)
+      if (bestUniqueSinkValue >= desiredMatrixDigraphUniqueSinkValue)
         ++rank;
 
-    return rank;
+    return std::min(rank, myRankCap);
+  }
+  /// Same as #candidateMargin but from the best unique sink values snapshot. @return 0 if none or not #computeMargins.
+  double bestDesiredMatrixDigraphMargin() const noexcept
+  {
+    double margin{ 0 };
+
+    if ((myDesiredMatrixDigraphIndex == InvalidIndex) or (not myMarginsAreComputed))
+      return margin;
+    if (bestDesiredMatrixDigraphRank() == myRankCap)
+      return cappedRankMargin();
+
+    auto const desiredMatrixDigraphUniqueSinkValue{ myBestUniqueSinkValues[myDesiredMatrixDigraphIndex] };
+    for (auto const bestUniqueSinkValue : myBestUniqueSinkValues)
+      if (bestUniqueSinkValue >= desiredMatrixDigraphUniqueSinkValue)
+        margin += cappedNormalizedLead(bestUniqueSinkValue, desiredMatrixDigraphUniqueSinkValue);
+
+    return margin;
   }
-  // Reverse-sort the matrix digraphs by output value.
+  // Reverse-sort the matrix digraphs by best output value.
   void reverseSortMatrixDigraphsByUniqueSinkValue()
   {
     std::sort(myMatrixDigraphPointers.begin(),
               myMatrixDigraphPointers.end(),
               [](auto const& firstMatrixDigraphPointer, auto const& secondMatrixDigraphPointer) {
-                return secondMatrixDigraphPointer->uniqueSinkValue() < firstMatrixDigraphPointer->uniqueSinkValue();
+                return secondMatrixDigraphPointer->bestUniqueSinkValue() <
+                       firstMatrixDigraphPointer->bestUniqueSinkValue();
               });
+
+    // Keep the desired index and the best unique sink values snapshot in step with the new order.
+    for (Index index{ 0 }; index != myMatrixDigraphPointers.size(); ++index) {
+      if (myMatrixDigraphPointers[index]->name() == myDesiredMatrixName)
+        myDesiredMatrixDigraphIndex = index;
+      myBestUniqueSinkValues[index] = myMatrixDigraphPointers[index]->bestUniqueSinkValue();
+    }
   }
   void logUniqueSinkValues(Logger& logger) const
   {
     logger << "In '" << myName << "':";
     for (auto const& matrixDigraphPointer : myMatrixDigraphPointers)
-      logger << ' ' << matrixDigraphPointer->name() << '(' << matrixDigraphPointer->uniqueSinkValue() << ')';
+      logger << ' ' << matrixDigraphPointer->name() << '(' << matrixDigraphPointer->bestUniqueSinkValue() << ')';
     logger << ".\n";
   }
 };
@@ -614,85 +1097,702 @@ public:
 ***********
 */
 
-/// Creates and holds a collection of Events and one Weights object, and control the training.
-class SupervisedNetworkTrainer
+/** Trains one weights crafter on its own supervised network events, one cycle at a time,
+    on the calling thread or via its own gofer threads pool.
+*/
+class SupervisedNetworkTrainingRun
 {
-public:
   // DEFINITIONS //
-  using MatrixDigraphsMap = std::map<std::string, MatrixDigraph::MatrixDigraphInstantiator>;
-  using WeightsCraftersMap = std::map<std::string, WeightsCrafter::WeightsCrafterInstantiator>;
-  constexpr static Index const SummarySecondsCount{ 60 };
+public:
+  // Target chunks count per gofer thread, so that uneven chunks still even out across the gofer threads.
+  constexpr static Index const ChunksPerGoferThread{ 4 };
+  /* Minimum cost of a chunk, in required weights times matrix digraphs, so that the queueing overhead stays
+     negligible: events with fewer matrix digraphs than that are never split.
+  */
+  constexpr static uint64_t const MinimumChunkCost{ 1 << 18 };
+  // Cycles during which each work unit runs as its own errand to measure its cost, before the first partition.
+  constexpr static long int const MeasuredCyclesCount{ 8 };
+  // Weight of the last measurement in each work unit's exponentially weighted moving average cost.
+  constexpr static double const CostSmoothing{ 1.0 / 16 };
+  // Cycles between checks of whether the measured costs drifted enough to repartition the work units.
+  constexpr static long int const RebalanceCheckCyclesCount{ 256 };
+  // Repartition only if the current partition's imbalance exceeds a new partition's one by this factor.
+  constexpr static double const RebalanceImbalanceFactor{ 1.1 };
+  /* Tied ranks totals are only broken by margins totals lower by this factor, as keeping the candidate values
+     evaluates the pruned matrix digraphs. Arbitrarily determined.
+  */
+  constexpr static double const TiedMarginsTotalFactor{ 0.99 };
+
+private:
+  // A rank errand and its keep errand, over either a whole unsplit event or one chunk of a split event.
+  struct ALIGN_CACHE_FRIENDLY WorkUnit
+  {
+    GoferThreadsPool::ErrandProcedure rank;
+    GoferThreadsPool::ErrandProcedure keep;
+    // Ticks spent by the last rank, written to by the gofer thread running it only.
+    decltype(Timer().elapsedTicks()) rankTicks{ 0 };
+    // Exponentially weighted moving average of rankTicks, updated on the main thread only.
+    double cost{ 0 };
+  };
+  // Work units indexes run sequentially by each errand.
+  using WorkUnitsPartition = std::vector<std::vector<Index>>;
 
   // INSTANCE VARIABLES //
 private:
   std::vector<SupervisedNetworkEvent> mySupervisedNetworkEvents;
   WeightsCrafter::WeightsCrafterPointer myWeightsCrafterPointer;
+  // Records the cycles, barriers, weights crafter steps and errands, if not null. Outlives the gofer threads pool.
+  std::shared_ptr<TraceRecorder> myTraceRecorderPointer;
   std::unique_ptr<GoferThreadsPool> myGoferThreadsPoolPointer;
-  long int myMaximumTrainingCyclesCount;
-  sig_atomic_t myAlive{ false };
+
+  /* Each work unit first runs as its own errand to measure its cost, then the work units get partitioned
+     into as many errands as gofer threads, and repartitioned if their costs drift.
+  */
+  std::vector<GoferThreadsPool::ErrandProcedure> myPrepareErrands, myRankErrands, myKeepErrands;
+  std::vector<WorkUnit> myWorkUnits;
+  WorkUnitsPartition myWorkUnitsPartition;
+  // Cycles since the work units were last populated.
+  long int myPartitionCyclesCount{ 0 };
+
+  // Applied to each new gofer threads pool, see #instrumentGoferThreads.
+  bool myGoferThreadsAreInstrumented{ false };
+
+  Index myRanksTotal{ 0 };
+  // Tie-breaker of the ranks total if #useMargins, else 0.
+  double myMarginsTotal{ 0 };
+  long int myCyclesCount{ 0 };
+
+  // DESTRUCTOR //
+public:
+  // Rule of five.
+  ~SupervisedNetworkTrainingRun() = default;
+
+  // CONSTRUCTORS //
+public:
+  /// Deleted.
+  SupervisedNetworkTrainingRun() = delete;
+
+  /// Assign the weights crafter to all the supervised network events.
+  SupervisedNetworkTrainingRun(std::vector<SupervisedNetworkEvent>&& supervisedNetworkEvents,
+                               WeightsCrafter::WeightsCrafterPointer const& weightsCrafterPointer)
+    : mySupervisedNetworkEvents(std::move(supervisedNetworkEvents))
+    , myWeightsCrafterPointer(weightsCrafterPointer)
+  {
+    if (mySupervisedNetworkEvents.empty() or (not myWeightsCrafterPointer))
+      throw std::logic_error(String(+"No events or null weightsCrafterPointer in: ", +__PRETTY_FUNCTION__, '.'));
+
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      supervisedNetworkEvent.useWeightsCrafter(myWeightsCrafterPointer);
+  }
+
+  /// Deleted as the errands point to the supervised network events.
+  SupervisedNetworkTrainingRun(SupervisedNetworkTrainingRun const&) = delete;
+  /// Deleted as the errands point to the supervised network events.
+  SupervisedNetworkTrainingRun(SupervisedNetworkTrainingRun&&) = delete;
+
+  // ASSIGNMENT OPERATORS //
+public:
+  /// Deleted as the errands point to the supervised network events.
+  SupervisedNetworkTrainingRun& operator=(SupervisedNetworkTrainingRun const&) = delete;
+  /// Deleted as the errands point to the supervised network events.
+  SupervisedNetworkTrainingRun& operator=(SupervisedNetworkTrainingRun&&) = delete;
+
+  // PRIVATE STATIC METHODS //
+private:
+  /// @return The work units partitioned into up to binsCount bins by Longest Processing Time first.
+  static WorkUnitsPartition partitionWorkUnits(std::vector<WorkUnit> const& workUnits, Index const binsCount)
+  {
+    std::vector<Index> workUnitIndexes(workUnits.size());
+    std::iota(workUnitIndexes.begin(), workUnitIndexes.end(), 0);
+    std::sort(workUnitIndexes.begin(), workUnitIndexes.end(), [&workUnits](auto const left, auto const right) {
+      return workUnits[left].cost > workUnits[right].cost;
+    });
+
+    // Min-heap of {load, bin index}: each work unit goes to the least loaded bin so far.
+    std::vector<std::pair<double, Index>> binLoads;
+    for (Index binIndex{ 0 }; binIndex != binsCount; ++binIndex)
+      binLoads.emplace_back(0, binIndex);
+    WorkUnitsPartition partition(binsCount);
+    for (auto const workUnitIndex : workUnitIndexes) {
+      std::pop_heap(binLoads.begin(), binLoads.end(), std::greater<>());
+      binLoads.back().first += workUnits[workUnitIndex].cost;
+      partition[binLoads.back().second].push_back(workUnitIndex);
+      std::push_heap(binLoads.begin(), binLoads.end(), std::greater<>());
+    }
+
+    partition.erase(std::remove_if(partition.begin(), partition.end(), [](auto const& bin) { return bin.empty(); }),
+                    partition.end());
+    return partition;
+  }
+  /// @return The most loaded bin's cost over the mean bin cost, 1 being perfectly balanced.
+  static double imbalance(std::vector<WorkUnit> const& workUnits,
+                          WorkUnitsPartition const& partition,
+                          Index const binsCount)
+  {
+    double maximumLoad{ 0 }, totalLoad{ 0 };
+    for (auto const& bin : partition) {
+      double load{ 0 };
+      for (auto const workUnitIndex : bin)
+        load += workUnits[workUnitIndex].cost;
+      maximumLoad = std::max(maximumLoad, load);
+      totalLoad += load;
+    }
+    return (totalLoad > 0) ? ((maximumLoad * binsCount) / totalLoad) : 1;
+  }
+  /// Populate the errands vectors, each errand running one bin of the partition and timing its rank work units.
+  static void populateErrands(std::vector<WorkUnit>& workUnits,
+                              WorkUnitsPartition const& partition,
+                              std::vector<GoferThreadsPool::ErrandProcedure>& rankErrands,
+                              std::vector<GoferThreadsPool::ErrandProcedure>& keepErrands)
+  {
+    rankErrands.clear();
+    keepErrands.clear();
+    for (auto const& bin : partition) {
+      rankErrands.emplace_back([&workUnits, &bin]() {
+        for (auto const workUnitIndex : bin) {
+          auto& workUnit{ workUnits[workUnitIndex] };
+          Timer timer;
+          workUnit.rank();
+          workUnit.rankTicks = timer.elapsedTicks();
+        }
+      });
+      keepErrands.emplace_back([&workUnits, &bin]() {
+        for (auto const workUnitIndex : bin)
+          workUnits[workUnitIndex].keep();
+      });
+    }
+  }
 
   // PRIVATE INSTANCE METHODS //
 private:
+  /** Split the events with many matrix digraphs into chunks so that a single large event does not leave the other
+      gofer threads idle, then populate the work units accordingly.
+  */
+  void splitEventsIntoChunks(Logger* const loggerPointer)
+  {
+    myPrepareErrands.clear();
+    myWorkUnits.clear();
+
+    // Evaluating a matrix digraph costs about its required weights count, common to all events.
+    uint64_t const matrixDigraphCost{ mySupervisedNetworkEvents[0].requiredWeightsCount() };
+    uint64_t totalCost{ 0 };
+    for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      totalCost += supervisedNetworkEvent.matrixDigraphsCount() * matrixDigraphCost;
+    auto const chunkCost{ std::max(
+      totalCost / (uint64_t{ myGoferThreadsPoolPointer->goferThreadsCount() } * ChunksPerGoferThread),
+      MinimumChunkCost) };
+
+    Index splitEventsCount{ 0 };
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      auto const eventCost{ supervisedNetworkEvent.matrixDigraphsCount() * matrixDigraphCost };
+      supervisedNetworkEvent.splitIntoChunks(static_cast<Index>((eventCost + (chunkCost / 2)) / chunkCost));
+
+      if (supervisedNetworkEvent.chunksCount() == 1)
+        myWorkUnits.push_back({ [&supervisedNetworkEvent]() { supervisedNetworkEvent.applyWeightsToRank(); },
+                                [&supervisedNetworkEvent]() { supervisedNetworkEvent.keepCandidateValues(); } });
+      else {
+        ++splitEventsCount;
+        if (loggerPointer)
+          *loggerPointer << "  ∙ Event '" << supervisedNetworkEvent.name() << "' is split into "
+                         << supervisedNetworkEvent.chunksCount() << " chunks of about "
+                         << (supervisedNetworkEvent.matrixDigraphsCount() / supervisedNetworkEvent.chunksCount())
+                         << " matrix digraphs.\n";
+        myPrepareErrands.emplace_back([&supervisedNetworkEvent]() { supervisedNetworkEvent.prepareToRank(); });
+        for (Index chunkIndex{ 0 }; chunkIndex != supervisedNetworkEvent.chunksCount(); ++chunkIndex)
+          myWorkUnits.push_back(
+            { [&supervisedNetworkEvent, chunkIndex]() { supervisedNetworkEvent.applyWeightsToRankChunk(chunkIndex); },
+              [&supervisedNetworkEvent, chunkIndex]() {
+                supervisedNetworkEvent.keepCandidateValuesChunk(chunkIndex);
+              } });
+      }
+    }
+    if (loggerPointer and (splitEventsCount == 0))
+      *loggerPointer << "  ∙ No event is large enough to be split into chunks.\n";
+
+    // Each work unit runs as its own errand until measured.
+    myWorkUnitsPartition.clear();
+    for (Index workUnitIndex{ 0 }; workUnitIndex != myWorkUnits.size(); ++workUnitIndex)
+      myWorkUnitsPartition.push_back({ workUnitIndex });
+    populateErrands(myWorkUnits, myWorkUnitsPartition, myRankErrands, myKeepErrands);
+    myPartitionCyclesCount = 0;
+  }
+
+  // Run procedure, recording it as a span named name if traced.
+  template<typename Procedure>
+  void traced(char const* const name, Procedure&& procedure)
+  {
+    if (not myTraceRecorderPointer) {
+      procedure();
+      return;
+    }
+    auto const beginTime{ TraceRecorder::Clock::now() };
+    procedure();
+    myTraceRecorderPointer->record(name, beginTime, TraceRecorder::Clock::now());
+  }
+
+  // Enqueue errands in the gofer threads pool, then wait for them all to complete, recorded as a span if traced.
+  void runErrandsBarrier(char const* const name, std::vector<GoferThreadsPool::ErrandProcedure> const& errands)
+  {
+    traced(name, [&]() {
+      myGoferThreadsPoolPointer->enQueueErrands(errands);
+      myGoferThreadsPoolPointer->waitForAllErrandsToComplete();
+    });
+  }
+
+  // Rank all the events via the gofer threads pool, then update the work units' measured costs and partition.
+  void rankViaGoferThreads(Logger* const loggerPointer)
+  {
+    // The split events' desired matrix digraphs first.
+    if (not myPrepareErrands.empty())
+      runErrandsBarrier("Prepare barrier", myPrepareErrands);
+    runErrandsBarrier("Rank barrier", myRankErrands);
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      supervisedNetworkEvent.reduceCandidateRank();
+
+    // Update the measured costs, then partition the work units once measured and whenever their costs drift.
+    ++myPartitionCyclesCount;
+    for (auto&& workUnit : myWorkUnits)
+      workUnit.cost = (myPartitionCyclesCount == 1)
+                        ? workUnit.rankTicks
+                        : (workUnit.cost + ((workUnit.rankTicks - workUnit.cost) * CostSmoothing));
+    if ((myPartitionCyclesCount == MeasuredCyclesCount) or
+        ((myPartitionCyclesCount > MeasuredCyclesCount) and
+         (((myPartitionCyclesCount - MeasuredCyclesCount) % RebalanceCheckCyclesCount) == 0))) {
+      Index const binsCount{ myGoferThreadsPoolPointer->goferThreadsCount() };
+      auto newWorkUnitsPartition{ partitionWorkUnits(myWorkUnits, binsCount) };
+      auto const currentImbalance{ imbalance(myWorkUnits, myWorkUnitsPartition, binsCount) };
+      auto const newImbalance{ imbalance(myWorkUnits, newWorkUnitsPartition, binsCount) };
+      if ((myPartitionCyclesCount == MeasuredCyclesCount) or
+          (currentImbalance > (newImbalance * RebalanceImbalanceFactor))) {
+        myWorkUnitsPartition = std::move(newWorkUnitsPartition);
+        populateErrands(myWorkUnits, myWorkUnitsPartition, myRankErrands, myKeepErrands);
+        if (loggerPointer) {
+          *loggerPointer << "  ∙ " << myWorkUnits.size() << " work units were "
+                         << ((myPartitionCyclesCount == MeasuredCyclesCount) ? "partitioned" : "repartitioned")
+                         << " into " << myWorkUnitsPartition.size() << " errands, with a measured imbalance of "
+                         << newImbalance;
+          if (myPartitionCyclesCount != MeasuredCyclesCount)
+            *loggerPointer << " instead of " << currentImbalance;
+          *loggerPointer << ".\n";
+        }
+      }
+    }
+  }
+
+  // PUBLIC INSTANCE METHODS //
+public:
+  /** Train on the calling thread if goferThreadsCount < 2, else via a new gofer threads pool of that many threads.
+      @param[in] loggerPointer Logs how the events are split into chunks, if not null.
+  */
+  void useGoferThreadsCount(Index const goferThreadsCount, Logger* const loggerPointer = nullptr)
+  {
+    myGoferThreadsPoolPointer.reset();
+    myPrepareErrands.clear();
+    myRankErrands.clear();
+    myKeepErrands.clear();
+    myWorkUnits.clear();
+    myWorkUnitsPartition.clear();
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      supervisedNetworkEvent.splitIntoChunks(1);
+
+    if (goferThreadsCount > 1) {
+      myGoferThreadsPoolPointer = std::make_unique<GoferThreadsPool>(goferThreadsCount);
+      myGoferThreadsPoolPointer->setInstrumented(myGoferThreadsAreInstrumented);
+      myGoferThreadsPoolPointer->setTraceRecorder(myTraceRecorderPointer.get());
+      splitEventsIntoChunks(loggerPointer);
+    }
+  }
+  /** Grow or shrink the gofer threads pool between cycles, keeping it, then split and partition the events anew.
+      Train on the calling thread if goferThreadsCount < 2.
+      @param[in] loggerPointer Logs how the events are split into chunks, if not null.
+  */
+  void resizeGoferThreadsPool(Index const goferThreadsCount, Logger* const loggerPointer = nullptr)
+  {
+    if ((goferThreadsCount < 2) or (not myGoferThreadsPoolPointer))
+      useGoferThreadsCount(goferThreadsCount, loggerPointer);
+    else {
+      myGoferThreadsPoolPointer->setGoferThreadsCount(goferThreadsCount);
+      splitEventsIntoChunks(loggerPointer);
+    }
+  }
+  decltype(auto) goferThreadsCount() const
+  {
+    return myGoferThreadsPoolPointer ? myGoferThreadsPoolPointer->goferThreadsCount() : 1U;
+  }
+  /// Record the cycles, barriers, weights crafter steps and errands into traceRecorderPointer, or stop if null.
+  void traceInto(std::shared_ptr<TraceRecorder> const& traceRecorderPointer)
+  {
+    myTraceRecorderPointer = traceRecorderPointer;
+    if (myGoferThreadsPoolPointer)
+      myGoferThreadsPoolPointer->setTraceRecorder(myTraceRecorderPointer.get());
+  }
+  /// Keep, or not, the statistics logged by #logGoferThreadsStatistics, in this and any later gofer threads pool.
+  void instrumentGoferThreads(bool const goferThreadsAreInstrumented)
+  {
+    myGoferThreadsAreInstrumented = goferThreadsAreInstrumented;
+    if (myGoferThreadsPoolPointer)
+      myGoferThreadsPoolPointer->setInstrumented(goferThreadsAreInstrumented);
+  }
+  /// @return True if #logGoferThreadsStatistics has statistics to log.
+  bool goferThreadsAreInstrumented() const noexcept
+  {
+    return myGoferThreadsPoolPointer and myGoferThreadsPoolPointer->isInstrumented();
+  }
+
+  auto const& supervisedNetworkEvents() const noexcept { return mySupervisedNetworkEvents; }
+  auto& supervisedNetworkEvents() noexcept { return mySupervisedNetworkEvents; }
+  auto const& weightsCrafter() const noexcept { return *myWeightsCrafterPointer; }
+  auto& weightsCrafter() noexcept { return *myWeightsCrafterPointer; }
+
+  /** Break the ties of the ranks total, or not, with the total of the margins by which the matrix digraphs ranking
+      above the desired ones lead them. Computed in the same pass, so that weights getting closer to a better rank
+      are kept rather than ignored.
+  */
+  void useMargins(bool const marginsAreUsed)
+  {
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      supervisedNetworkEvent.computeMargins(marginsAreUsed);
+  }
+  decltype(auto) marginsAreUsed() const noexcept { return mySupervisedNetworkEvents[0].marginsAreComputed(); }
+
+  /** Append supervisedNetworkEvents, requiring the weights crafter's weights count, to the events being trained,
+      keeping the gofer threads pool. Call #establishBestState before training on.
+      @param[in] loggerPointer Logs how the events are split into chunks, if not null.
+  */
+  void appendSupervisedNetworkEvents(std::vector<SupervisedNetworkEvent>&& supervisedNetworkEvents,
+                                     Logger* const loggerPointer = nullptr)
+  {
+    for (auto&& supervisedNetworkEvent : supervisedNetworkEvents) {
+      supervisedNetworkEvent.useWeightsCrafter(myWeightsCrafterPointer);
+      supervisedNetworkEvent.computeMargins(marginsAreUsed());
+      mySupervisedNetworkEvents.push_back(std::move(supervisedNetworkEvent));
+    }
+
+    // The errands point to the supervised network events, which may have moved.
+    if (myGoferThreadsPoolPointer)
+      splitEventsIntoChunks(loggerPointer);
+  }
+
+  /// @return The total of the desired matrix digraphs' ranks of the best weights so far.
+  decltype(auto) ranksTotal() const noexcept { return myRanksTotal; }
+  /// @return The total of the margins of the best weights so far if #useMargins, else 0.
+  decltype(auto) marginsTotal() const noexcept { return myMarginsTotal; }
+  /// @return The lowest possible #ranksTotal, reached when every desired matrix digraph ranks first.
+  Index ranksCount() const noexcept
+  {
+    Index ranksCount{ 0 };
+    for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents)
+      ranksCount += supervisedNetworkEvent.rankWeight();
+    return ranksCount;
+  }
+  /// @return The training cycles run by #trainOneCycle.
+  decltype(auto) cyclesCount() const noexcept { return myCyclesCount; }
+
+  /** Establish the exact best state from the current weights, as they are the best so far.
+      Once trained, bring back the weights crafter's best weights first.
+  */
+  void establishBestState()
+  {
+    myRanksTotal = 0;
+    myMarginsTotal = 0;
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      supervisedNetworkEvent.applyWeights();
+      supervisedNetworkEvent.keepCandidateValues();
+      myRanksTotal += supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.bestDesiredMatrixDigraphRank();
+      if (supervisedNetworkEvent.marginsAreComputed())
+        myMarginsTotal +=
+          supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.bestDesiredMatrixDigraphMargin();
+    }
+    // Tell the weights that they improved on the maximum ranks, as they are now the best ones.
+    myWeightsCrafterPointer->weightsImproved();
+  }
+
+  /** Rank all the events with the weights crafter's current weights, keep them if they improve the ranks total,
+      or tie it with a low enough margins total if #useMargins, and tell the weights crafter accordingly.
+      @pre #establishBestState was called.
+      @param[in] loggerPointer Logs how the work units are partitioned, if not null.
+      @return True if the ranks total decreased.
+  */
+  bool trainOneCycle(Logger* const loggerPointer = nullptr)
+  {
+    auto const beginTime{ myTraceRecorderPointer ? TraceRecorder::Clock::now() : TraceRecorder::Clock::time_point() };
+    ++myCyclesCount;
+
+    if (myGoferThreadsPoolPointer)
+      rankViaGoferThreads(loggerPointer);
+    else
+      // Calculate all event networks on the calling thread.
+      traced("Rank", [&]() {
+        for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+          supervisedNetworkEvent.applyWeightsToRank();
+      });
+
+    Index newRanksTotal{ 0 };
+    double newMarginsTotal{ 0 };
+    for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      newRanksTotal += supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.candidateRank();
+      newMarginsTotal += supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.candidateMargin();
+    }
+
+    bool const ranksDecreased{ newRanksTotal < myRanksTotal };
+    if (ranksDecreased or
+        ((newRanksTotal == myRanksTotal) and (newMarginsTotal < (myMarginsTotal * TiedMarginsTotalFactor)))) {
+      myRanksTotal = newRanksTotal;
+      myMarginsTotal = newMarginsTotal;
+      // Keep the candidate values as the best ones BEFORE the weights get altered again.
+      if (myGoferThreadsPoolPointer)
+        runErrandsBarrier("Keep barrier", myKeepErrands);
+      else
+        traced("Keep", [&]() {
+          for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
+            supervisedNetworkEvent.keepCandidateValues();
+        });
+      // Tell the weights that they improved.
+      traced("Weights improved", [&]() { myWeightsCrafterPointer->weightsImproved(); });
+    } else
+      // Tell the weights that they did not improve. The rejected candidate values need no reverting.
+      traced("Weights did not improve", [&]() { myWeightsCrafterPointer->weightsDidNotImprove(); });
+
+    if (myTraceRecorderPointer)
+      myTraceRecorderPointer->record("Cycle", beginTime, TraceRecorder::Clock::now());
+
+    return ranksDecreased;
+  }
+
+  /// Apply the weights to all the non-input values, either one last time or once, and keep them.
+  void finish()
+  {
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      supervisedNetworkEvent.applyWeights();
+      supervisedNetworkEvent.keepCandidateValues();
+    }
+  }
+
   void logRanks(Logger& logger) const
   {
     Index ranksTotal{ 0 };
-    for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents)
-      ranksTotal += supervisedNetworkEvent.desiredMatrixDigraphRank();
+    double marginsTotal{ 0 };
+    bool weighted{ false };
+    for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      ranksTotal += supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.bestDesiredMatrixDigraphRank();
+      marginsTotal += supervisedNetworkEvent.rankWeight() * supervisedNetworkEvent.bestDesiredMatrixDigraphMargin();
+      weighted = weighted or (supervisedNetworkEvent.rankWeight() != 1);
+    }
 
-    logger << "  ∙ The " << mySupervisedNetworkEvents.size() << " ranks totalling " << ranksTotal << " are:\n";
+    logger << "  ∙ The " << mySupervisedNetworkEvents.size() << " ranks";
+    if (auto const rankCap{ mySupervisedNetworkEvents[0].rankCap() }; rankCap != InvalidIndex)
+      logger << " capped at " << rankCap;
+    if (weighted)
+      logger << " weighted";
+    logger << " totalling " << ranksTotal;
+    if (marginsAreUsed())
+      logger << " with margins totalling " << marginsTotal;
+    logger << " are:\n";
     for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents) {
-      logger << "    ◦ " << supervisedNetworkEvent.desiredMatrixDigraphRank() << " for '"
-             << supervisedNetworkEvent.desiredMatrixName() << "' in '" << supervisedNetworkEvent.name() << "'.\n";
+      logger << "    ◦ " << supervisedNetworkEvent.bestDesiredMatrixDigraphRank();
+      if (weighted)
+        logger << " × " << supervisedNetworkEvent.rankWeight();
+      logger << " for '" << supervisedNetworkEvent.desiredMatrixName() << "' in '" << supervisedNetworkEvent.name()
+             << "'.\n";
     }
   }
 
-  void train(Logger& logger)
+  /// Log then reset the share of matrix digraph evaluations pruned by their unique sink value bounds.
+  void logPrunedEvaluations(Logger& logger)
   {
-    myAlive = true;
+    uint64_t evaluatedCount{ 0 }, prunedCount{ 0 };
+    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+      auto const [eventEvaluatedCount, eventPrunedCount]{ supervisedNetworkEvent.takeEvaluatedAndPrunedCounts() };
+      evaluatedCount += eventEvaluatedCount;
+      prunedCount += eventPrunedCount;
+    }
+    if (auto const totalCount{ evaluatedCount + prunedCount })
+      logger << "    ◦ Bounds pruned " << (static_cast<double>(prunedCount * 100) / static_cast<double>(totalCount))
+             << "% of the matrix digraph evaluations.\n";
+  }
+  /// Log then reset how long the errands of each gofer thread were queued and ran, and how long it idled, if any.
+  void logGoferThreadsStatistics(Logger& logger)
+  {
+    if ((not myGoferThreadsPoolPointer) or (not myGoferThreadsPoolPointer->isInstrumented()))
+      return;
+
+    auto const logDuration{ [&](double const nanoseconds) {
+      if (nanoseconds < 1E3)
+        logger << nanoseconds << " ns";
+      else if (nanoseconds < 1E6)
+        logger << (nanoseconds / 1E3) << " µs";
+      else if (nanoseconds < 1E9)
+        logger << (nanoseconds / 1E6) << " ms";
+      else
+        logger << (nanoseconds / 1E9) << " s";
+    } };
+    auto const logDurations{ [&](GoferThreadsPool::DurationsHistogram const& durationsHistogram) {
+      logDuration(durationsHistogram.meanNanoseconds());
+      logger << " (99% under ";
+      logDuration(static_cast<double>(durationsHistogram.percentileNanoseconds(0.99)));
+      logger << ')';
+    } };
 
-    logger << "\n● Will train for UP TO " << myMaximumTrainingCyclesCount << " cycles...\n";
+    auto const goferThreadsStatistics{ myGoferThreadsPoolPointer->takeGoferThreadsStatistics() };
+    uint64_t runNanoseconds{ 0 }, idleNanoseconds{ 0 };
+    for (auto const& goferThreadStatistics : goferThreadsStatistics) {
+      runNanoseconds += goferThreadStatistics.runDurations.totalNanoseconds;
+      idleNanoseconds += goferThreadStatistics.idleDurations.totalNanoseconds;
+    }
+    if (auto const totalNanoseconds{ runNanoseconds + idleNanoseconds })
+      logger << "    ◦ Gofer threads were busy "
+             << (static_cast<double>(runNanoseconds * 100) / static_cast<double>(totalNanoseconds))
+             << "% of the time.\n";
+    for (std::size_t index{ 0 }; index != goferThreadsStatistics.size(); ++index) {
+      auto const& goferThreadStatistics{ goferThreadsStatistics[index] };
+      if (goferThreadStatistics.runDurations.count() == 0)
+        continue;
+      logger << "    ◦ Gofer thread " << (index + 1) << (goferThreadStatistics.retired ? " (retired)" : "")
+             << " was busy " << (goferThreadStatistics.busyShare() * 100) << "%, running "
+             << goferThreadStatistics.runDurations.count() << " errands of ";
+      logDurations(goferThreadStatistics.runDurations);
+      logger << ", queued for ";
+      logDurations(goferThreadStatistics.queuedDurations);
+      logger << ", idle for ";
+      logDurations(goferThreadStatistics.idleDurations);
+      logger << ".\n";
+    }
+  }
+};
+
+/*
+***********
+** CLASS **
+***********
+*/
+
+/// Creates and holds a collection of Events and one Weights object, and control the training.
+class SupervisedNetworkTrainer
+{
+public:
+  // DEFINITIONS //
+  using MatrixDigraphsMap = std::map<std::string, MatrixDigraph::MatrixDigraphInstantiator>;
+  using WeightsCraftersMap = std::map<std::string, WeightsCrafter::WeightsCrafterInstantiator>;
+  constexpr static Index const SummarySecondsCount{ 60 };
+  constexpr static Index const MaximumRestartsCount{ 64 };
+  // Restart portfolio runs train concurrently for this long between comparisons.
+  constexpr static Index const EpochSecondsCount{ 5 };
+  // Restart portfolio runs are not abandoned before this many epochs.
+  constexpr static Index const MinimumEpochsBeforeAbandoningCount{ 3 };
+  // Restart portfolio runs whose ranks total exceeds the leader's by this factor are abandoned.
+  constexpr static double const TrailingRanksTotalFactor{ 1.25 };
+  // Keeps the weighted ranks totals far from overflowing.
+  constexpr static Index const MaximumEventWeight{ 100 };
+  // In continual mode, how often to check for a request to append events, once trained.
+  constexpr static Index const ContinualPollMillisecondsCount{ 100 };
+  // In elastic mode following the load, how often to check it, as the load average lags by about a minute.
+  constexpr static Index const ElasticLoadCheckSecondsCount{ 60 };
+  // Spans preallocated by option --trace, of 32 bytes each, the later ones being dropped.
+  constexpr static std::size_t const TraceSpansCapacity{ 1'000'000 };
+
+  // What walk-forward mode learns of each window of events.
+  struct WalkForwardStep
+  {
+    Index ranksTotal{ InvalidIndex };
+    long int cyclesCount{ 0 };
+    // Rank of the desired matrix digraph of the event following the window, uncapped.
+    Index evaluatedRank{ InvalidIndex };
+  };
+
+  // INSTANCE VARIABLES //
+private:
+  // A single run, or the restart portfolio's runs. Only the best one is left once trained.
+  std::vector<std::unique_ptr<SupervisedNetworkTrainingRun>> myTrainingRuns;
+  long int myMaximumTrainingCyclesCount;
+  sig_atomic_t myAlive{ false };
+  // Event files' column indexes to keep, empty to keep them all.
+  std::vector<Index> myColumnIndexes;
+  // Gofer threads shared among the training runs.
+  Index myTrainingThreadsCount{ 1 };
+  MatrixDigraph::MatrixDigraphInstantiator myMatrixDigraphInstantiator;
+  Index myRankCap{ InvalidIndex };
+  // Continual mode's control file, listing the events to append on request. Empty if not in continual mode.
+  std::string myContinualControlFileName;
+  sig_atomic_t myEventsAppendingIsRequested{ false };
+  // Walk-forward mode's window, in events. 0 if not in walk-forward mode.
+  Index myWalkForwardWindow{ 0 };
+  // Walk-forward mode's events, in chronological order, and one weights crafter per independent chain of windows.
+  std::vector<SupervisedNetworkEvent> myWalkForwardEvents;
+  std::vector<WeightsCrafter::WeightsCrafterPointer> myWalkForwardWeightsCrafterPointers;
+  // Elastic mode's control file, holding the number of training threads to resize to on request. Empty if none.
+  std::string myElasticControlFileName;
+  sig_atomic_t myResizingIsRequested{ false };
+  // Elastic mode following the load of the machine, checked every ElasticLoadCheckSecondsCount.
+  bool myElasticModeFollowsLoad{ false };
+  std::chrono::steady_clock::time_point myLoadCheckTime;
+  // Records the training runs' spans, written as Chrome trace-event JSON to myTraceFileName. Null if not traced.
+  std::shared_ptr<TraceRecorder> myTraceRecorderPointer;
+  std::string myTraceFileName;
+
+  // PRIVATE INSTANCE METHODS //
+private:
+  /** Elastic mode: resize the training threads to the count held by the control file if requested, or following
+      the load of the machine, the CPU budget minus the load not due to the training threads.
+      @return True if myTrainingThreadsCount changed, else false, and log errors.
+  */
+  bool adaptTrainingThreadsCount(Logger& logger)
+  {
+    Index trainingThreadsCount{ myTrainingThreadsCount };
+    if (myResizingIsRequested and (not myElasticControlFileName.empty())) {
+      myResizingIsRequested = false;
+      std::ifstream controlFile(myElasticControlFileName);
+      long int requestedCount;
+      if ((not(controlFile >> requestedCount)) or (requestedCount < 0) or
+          (requestedCount > static_cast<long int>(GoferThreadsPool::MaximumGoferThreadsCount))) {
+        logger.error() << "File '" << myElasticControlFileName
+                       << "' must hold a number of training threads, 0 or between "
+                       << GoferThreadsPool::MinimumGoferThreadsCount << " and "
+                       << GoferThreadsPool::MaximumGoferThreadsCount << ".\n\n";
+        return false;
+      }
+      trainingThreadsCount = requestedCount ? static_cast<Index>(requestedCount)
+                                            : static_cast<Index>(GoferThreadsPool::defaultGoferThreadsCount());
+    } else if (myElasticModeFollowsLoad) {
+      auto const now{ std::chrono::steady_clock::now() };
+      if (now < (myLoadCheckTime + std::chrono::seconds(ElasticLoadCheckSecondsCount)))
+        return false;
+      myLoadCheckTime = now;
 
-    // Populate the errands vector.
-    std::vector<GoferThreadsPool::ErrandProcedure> errands;
-    if (myGoferThreadsPoolPointer) {
-      errands.reserve(mySupervisedNetworkEvents.size());
-      for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
-        errands.emplace_back([&supervisedNetworkEvent]() { supervisedNetworkEvent.applyWeights(); });
+      std::ifstream loadFile("/proc/loadavg");
+      double load;
+      if (not(loadFile >> load))
+        return false;
+      // The load average counts the busy training threads themselves.
+      auto const othersLoad{ std::max(load - static_cast<double>(myTrainingThreadsCount), 0.0) };
+      auto const cpusCount{ static_cast<double>(std::get<0>(CpuBudget())) };
+      trainingThreadsCount = static_cast<Index>(std::max(cpusCount - othersLoad, 1.0));
     }
+    if (trainingThreadsCount == myTrainingThreadsCount)
+      return false;
 
-    Index const ranksCount{ static_cast<Index>(mySupervisedNetworkEvents.size()) };
-    // Set the initial ranks to maximum default.
-    Index ranksTotal{ 0 };
-    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
-      ranksTotal += supervisedNetworkEvent.matrixDigraphsCount();
+    logger << "  ∙ Training threads are resized from " << myTrainingThreadsCount << " to " << trainingThreadsCount
+           << ".\n";
+    myTrainingThreadsCount = trainingThreadsCount;
+    return true;
+  }
+
+  // Train the single training run, logging a summary on each improvement and every SummarySecondsCount.
+  void trainSingleRun(Logger& logger)
+  {
+    auto& trainingRun{ *myTrainingRuns[0] };
+    trainingRun.establishBestState();
+    trainingRun.logRanks(logger);
 
     long int cyclesCount, lastCyclesCount{ 0 }, summaryCyclesCount{ 100 };
     Timer timer;
     // Train up to maximum training cycles count or until the total ranks count reaches the event networks count.
     for (cyclesCount = 1, ++myMaximumTrainingCyclesCount;
-         myAlive and (cyclesCount != myMaximumTrainingCyclesCount) and (ranksTotal > ranksCount);
+         myAlive and (not myEventsAppendingIsRequested) and (cyclesCount != myMaximumTrainingCyclesCount) and
+         (trainingRun.ranksTotal() > trainingRun.ranksCount());
          ++cyclesCount) {
-      if (myGoferThreadsPoolPointer) {
-        // Calculate all event networks via the gofer threads pool.
-        myGoferThreadsPoolPointer->enQueueErrands(errands);
-        myGoferThreadsPoolPointer->waitForAllErrandsToComplete();
-      } else
-        // Calculate all event networks on the main thread.
-        for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
-          supervisedNetworkEvent.applyWeights();
-
-      Index newRanksTotal{ 0 };
-      for (auto const& supervisedNetworkEvent : mySupervisedNetworkEvents)
-        newRanksTotal += supervisedNetworkEvent.desiredMatrixDigraphRank();
-
-      bool const ranksDecreased{ newRanksTotal < ranksTotal };
-      if (ranksDecreased) {
-        ranksTotal = newRanksTotal;
-        // Tell the weights that they improved.
-        myWeightsCrafterPointer->weightsImproved();
-      } else
-        // Tell the weights that they did not improve.
-        myWeightsCrafterPointer->weightsDidNotImprove();
+      bool const ranksDecreased{ trainingRun.trainOneCycle(&logger) };
+      if (adaptTrainingThreadsCount(logger))
+        trainingRun.resizeGoferThreadsPool(myTrainingThreadsCount, &logger);
 
       if (ranksDecreased or (cyclesCount == summaryCyclesCount)) {
         auto const elapsedTicks{ timer.elapsedTicks() };
@@ -712,10 +1812,12 @@ private:
         else
           logger << secondsLeft << " seconds";
         logger << " left at " << (elapsedCycles_ticksPerSecond / elapsedTicks) << " cycles/sec.\n    ◦ ";
-        myWeightsCrafterPointer->logCurrentState(logger);
+        trainingRun.weightsCrafter().logCurrentState(logger);
+        trainingRun.logPrunedEvaluations(logger);
+        trainingRun.logGoferThreadsStatistics(logger);
 
         if (ranksDecreased) {
-          logRanks(logger);
+          trainingRun.logRanks(logger);
         }
 
         summaryCyclesCount = cyclesCount + ((elapsedCycles_ticksPerSecond * SummarySecondsCount) / elapsedTicks);
@@ -729,10 +1831,384 @@ private:
     --myMaximumTrainingCyclesCount;
 
     logger << "\n● Trained for " << cyclesCount << " cycles.\n";
+  }
+
+  /// Build supervisedNetworkEvent from its event file. @return True on success, else false, and log errors.
+  bool buildSupervisedNetworkEvent(Logger& logger,
+                                   std::string const& desiredMatrixName,
+                                   std::string const& eventFileName,
+                                   SupervisedNetworkEvent& supervisedNetworkEvent) const
+  {
+    logger << "  ∙ Parsing event file '" << eventFileName << "'...\n";
+
+    // Open the event file in binary reading mode.
+    auto eventFileStatus{ OpenInputBinaryFileNamed(eventFileName) };
+    auto const& [eventFile, errorMessage, eventFileSize] = eventFileStatus;
+    if (not eventFile.good()) {
+      logger.streamCondition(eventFile) << errorMessage << "\n\n";
+      return false;
+    }
+
+    // Build a new matrix digraph.
+    if (not supervisedNetworkEvent.buildMatrixDigraphs(
+          logger, desiredMatrixName, eventFileStatus, myMatrixDigraphInstantiator, myColumnIndexes))
+      return false;
+    supervisedNetworkEvent.setName(eventFileName);
+    supervisedNetworkEvent.setRankCap(myRankCap);
+
+    return true;
+  }
+
+  /** Continual mode: wait until requested to append events, or to stop.
+      @return True if requested to append events.
+  */
+  bool waitForEventsAppendingRequest(Logger& logger)
+  {
+    logger << "\n● Waiting for signal SIGUSR1 to append the events listed in file '" << myContinualControlFileName
+           << "'...\n";
+    while (myAlive and (not myEventsAppendingIsRequested))
+      std::this_thread::sleep_for(std::chrono::milliseconds(ContinualPollMillisecondsCount));
+    return myAlive;
+  }
+
+  /** Continual mode: append the events listed in the control file and not yet trained on, to the training run,
+      without reloading the others. Each line lists a desired matrix name, an event file name and, optionally,
+      a rank weight. An event that can not be appended is logged and skipped.
+      @return True if any event was appended.
+  */
+  bool appendEvents(Logger& logger)
+  {
+    myEventsAppendingIsRequested = false;
+    auto& trainingRun{ *myTrainingRuns[0] };
+
+    logger << "\n● Appending the new events listed in file '" << myContinualControlFileName << "'...\n";
+    std::ifstream controlFile(myContinualControlFileName);
+    if (not controlFile.good()) {
+      logger.streamCondition(controlFile) << "Can not open file '" << myContinualControlFileName
+                                          << "' for reading.\n\n";
+      return false;
+    }
+
+    auto const weightsRegions{ trainingRun.supervisedNetworkEvents()[0].weightsRegions() };
+    std::vector<SupervisedNetworkEvent> supervisedNetworkEvents;
+    for (std::string line; std::getline(controlFile, line);) {
+      std::istringstream lineStream(line);
+      std::string desiredMatrixName, eventFileName;
+      if (not(lineStream >> desiredMatrixName >> eventFileName))
+        continue;
+      Index rankWeight{ 1 };
+      if ((not(lineStream >> rankWeight).fail()) and ((rankWeight < 1) or (rankWeight > MaximumEventWeight))) {
+        logger.error() << "Rank weight " << rankWeight << " of event file '" << eventFileName
+                       << "' is not between 1 and " << MaximumEventWeight << ".\n\n";
+        continue;
+      }
+
+      // Skip the events already trained on.
+      auto const isKnown{ [&eventFileName](auto const& supervisedNetworkEvent) {
+        return supervisedNetworkEvent.name() == eventFileName;
+      } };
+      if (std::any_of(trainingRun.supervisedNetworkEvents().cbegin(), trainingRun.supervisedNetworkEvents().cend(),
+                      isKnown) or
+          std::any_of(supervisedNetworkEvents.cbegin(), supervisedNetworkEvents.cend(), isKnown))
+        continue;
+
+      SupervisedNetworkEvent supervisedNetworkEvent;
+      if (not buildSupervisedNetworkEvent(logger, desiredMatrixName, eventFileName, supervisedNetworkEvent))
+        continue;
+      if (supervisedNetworkEvent.requiredWeightsCount() != trainingRun.weightsCrafter().weightsCount()) {
+        logger.error() << "Event '" << eventFileName << "' requires " << supervisedNetworkEvent.requiredWeightsCount()
+                       << " weights instead of " << trainingRun.weightsCrafter().weightsCount() << ".\n\n";
+        continue;
+      }
+      if (supervisedNetworkEvent.weightsRegions() != weightsRegions) {
+        logger.error() << "Event '" << eventFileName
+                       << "' does not divide its weights into the same regions as the others.\n\n";
+        continue;
+      }
+      supervisedNetworkEvent.setRankWeight(rankWeight);
+      supervisedNetworkEvents.push_back(std::move(supervisedNetworkEvent));
+    }
+
+    logger << "  ∙ " << supervisedNetworkEvents.size() << " new events were appended to the "
+           << trainingRun.supervisedNetworkEvents().size() << " trained ones.\n";
+    if (supervisedNetworkEvents.empty())
+      return false;
+
+    trainingRun.appendSupervisedNetworkEvents(std::move(supervisedNetworkEvents), &logger);
+    return true;
+  }
+
+  /// Share the training threads among the training runs, the leading ones getting the remainder.
+  void shareTrainingThreads(Logger& logger)
+  {
+    std::vector<SupervisedNetworkTrainingRun*> trainingRunPointers;
+    for (auto const& trainingRunPointer : myTrainingRuns)
+      trainingRunPointers.push_back(trainingRunPointer.get());
+    std::stable_sort(trainingRunPointers.begin(), trainingRunPointers.end(), [](auto const left, auto const right) {
+      return left->ranksTotal() < right->ranksTotal();
+    });
+
+    auto const trainingRunsCount{ static_cast<Index>(trainingRunPointers.size()) };
+    for (Index index{ 0 }; index != trainingRunsCount; ++index) {
+      auto const goferThreadsCount{ std::max(
+        (myTrainingThreadsCount / trainingRunsCount) + ((index < (myTrainingThreadsCount % trainingRunsCount)) ? 1 : 0),
+        Index{ 1 }) };
+      if (goferThreadsCount != trainingRunPointers[index]->goferThreadsCount())
+        trainingRunPointers[index]->useGoferThreadsCount(goferThreadsCount);
+    }
+
+    logger << "  ∙ Training threads per run:";
+    for (auto const& trainingRunPointer : myTrainingRuns)
+      logger << ' ' << trainingRunPointer->goferThreadsCount();
+    logger << ".\n";
+  }
+
+  /** Train the restart portfolio's runs concurrently, each on its own thread with its own share of the gofer
+      threads, in epochs of EpochSecondsCount. After each epoch, the runs trailing the leader by far enough are
+      abandoned and their gofer threads given to the others.
+  */
+  void trainPortfolio(Logger& logger)
+  {
+    logger << "  ∙ " << myTrainingRuns.size() << " independently seeded runs will train concurrently, in epochs of "
+           << EpochSecondsCount << " seconds.\n";
+    for (auto&& trainingRunPointer : myTrainingRuns)
+      trainingRunPointer->establishBestState();
+
+    // Train up to the deadline, the maximum training cycles count, until the ranks total is minimal or until stopped.
+    auto const trainUntil{ [this](SupervisedNetworkTrainingRun& trainingRun,
+                                  std::chrono::steady_clock::time_point const deadline) {
+      while (myAlive and (trainingRun.cyclesCount() < myMaximumTrainingCyclesCount) and
+             (trainingRun.ranksTotal() > trainingRun.ranksCount()) and (std::chrono::steady_clock::now() < deadline))
+        trainingRun.trainOneCycle();
+    } };
+
+    for (Index epochsCount{ 1 }; myAlive; ++epochsCount) {
+      auto const deadline{ std::chrono::steady_clock::now() + std::chrono::seconds(EpochSecondsCount) };
+      // The first run trains on the current thread.
+      std::vector<std::thread> trainingThreads;
+      for (auto trainingRunIterator{ myTrainingRuns.begin() + 1 }; trainingRunIterator != myTrainingRuns.end();
+           ++trainingRunIterator)
+        trainingThreads.emplace_back(trainUntil, std::ref(**trainingRunIterator), deadline);
+      trainUntil(*myTrainingRuns[0], deadline);
+      for (auto&& trainingThread : trainingThreads)
+        trainingThread.join();
+
+      // Log the epoch and locate the leader.
+      logger << "  ∙ Epoch " << epochsCount << ", ranks totals (cycles spent) per run:";
+      Index leaderIndex{ 0 };
+      bool allTrained{ true };
+      for (Index index{ 0 }; index != myTrainingRuns.size(); ++index) {
+        auto const& trainingRun{ *myTrainingRuns[index] };
+        logger << ' ' << trainingRun.ranksTotal() << " (" << trainingRun.cyclesCount() << ')';
+        if (trainingRun.ranksTotal() < myTrainingRuns[leaderIndex]->ranksTotal())
+          leaderIndex = index;
+        if (trainingRun.cyclesCount() < myMaximumTrainingCyclesCount)
+          allTrained = false;
+      }
+      logger << ".\n";
+      for (Index index{ 0 }; index != myTrainingRuns.size(); ++index)
+        if (auto& trainingRun{ *myTrainingRuns[index] }; trainingRun.goferThreadsAreInstrumented()) {
+          logger << "  ∙ Run " << (index + 1) << "'s training threads:\n";
+          trainingRun.logGoferThreadsStatistics(logger);
+        }
+
+      auto const leaderRanksTotal{ myTrainingRuns[leaderIndex]->ranksTotal() };
+      if (allTrained or (leaderRanksTotal == myTrainingRuns[leaderIndex]->ranksCount()))
+        break;
+
+      if (adaptTrainingThreadsCount(logger))
+        shareTrainingThreads(logger);
+
+      // Abandon the badly trailing runs, and give their gofer threads to the others.
+      if ((epochsCount >= MinimumEpochsBeforeAbandoningCount) and (myTrainingRuns.size() > 1)) {
+        auto const trailingRanksTotal{ static_cast<double>(leaderRanksTotal) * TrailingRanksTotalFactor };
+        auto const trainingRunsCount{ myTrainingRuns.size() };
+        myTrainingRuns.erase(std::remove_if(myTrainingRuns.begin(),
+                                            myTrainingRuns.end(),
+                                            [trailingRanksTotal](auto const& trainingRunPointer) {
+                                              return trainingRunPointer->ranksTotal() > trailingRanksTotal;
+                                            }),
+                             myTrainingRuns.end());
+        if (myTrainingRuns.size() != trainingRunsCount) {
+          logger << "  ∙ Abandoned " << (trainingRunsCount - myTrainingRuns.size())
+                 << " runs trailing the leader's ranks total of " << leaderRanksTotal << ".\n";
+          shareTrainingThreads(logger);
+        }
+      }
+    }
+
+    // Keep only the best run.
+    std::stable_sort(myTrainingRuns.begin(), myTrainingRuns.end(), [](auto const& left, auto const& right) {
+      return left->ranksTotal() < right->ranksTotal();
+    });
+    myTrainingRuns.resize(1);
+
+    logger << "\n● The best run trained for " << myTrainingRuns[0]->cyclesCount() << " cycles:\n";
+    logger << "  ∙ ";
+    myTrainingRuns[0]->weightsCrafter().logCurrentState(logger);
+    myTrainingRuns[0]->logRanks(logger);
+  }
+
+  /** Walk-forward mode: train on the chain's windows in order, each warm-started from the best weights of the
+      previous one, and evaluate the event following each window with the weights trained on it.
+      Stop early when not alive, leaving the remaining steps unevaluated.
+  */
+  void walkForwardChain(Logger& logger,
+                        std::mutex& loggerMutex,
+                        WeightsCrafter::WeightsCrafterPointer const& weightsCrafterPointer,
+                        Index const goferThreadsCount,
+                        Index const firstStepIndex,
+                        Index const endStepIndex,
+                        std::vector<WalkForwardStep>& walkForwardSteps)
+  {
+    for (auto stepIndex{ firstStepIndex }; myAlive and (stepIndex != endStepIndex); ++stepIndex) {
+      // The window's events are copied from the loaded ones, never reloaded.
+      auto const windowBegin{ myWalkForwardEvents.cbegin() + stepIndex };
+      SupervisedNetworkTrainingRun trainingRun(
+        std::vector<SupervisedNetworkEvent>(windowBegin, windowBegin + myWalkForwardWindow), weightsCrafterPointer);
+      trainingRun.traceInto(myTraceRecorderPointer);
+      trainingRun.useGoferThreadsCount(goferThreadsCount);
+      trainingRun.establishBestState();
+      if (myMaximumTrainingCyclesCount > 1)
+        while (myAlive and (trainingRun.cyclesCount() < myMaximumTrainingCyclesCount) and
+               (trainingRun.ranksTotal() > trainingRun.ranksCount()))
+          trainingRun.trainOneCycle();
+      weightsCrafterPointer->bringBackBestWeights();
+
+      // Evaluate the following event with the best weights, uncapped.
+      SupervisedNetworkEvent evaluatedEvent(*(windowBegin + myWalkForwardWindow));
+      evaluatedEvent.setRankCap(InvalidIndex);
+      evaluatedEvent.useWeightsCrafter(weightsCrafterPointer);
+      evaluatedEvent.applyWeights();
+      evaluatedEvent.keepCandidateValues();
+
+      auto& walkForwardStep{ walkForwardSteps[stepIndex] };
+      walkForwardStep.ranksTotal = trainingRun.ranksTotal();
+      walkForwardStep.cyclesCount = trainingRun.cyclesCount();
+      walkForwardStep.evaluatedRank = evaluatedEvent.bestDesiredMatrixDigraphRank();
+
+      std::lock_guard<std::mutex> const loggerLock(loggerMutex);
+      logger << "  ∙ Window '" << windowBegin->name() << "' to '" << (windowBegin + myWalkForwardWindow - 1)->name()
+             << "' trained for " << walkForwardStep.cyclesCount << " cycles to a ranks total of "
+             << walkForwardStep.ranksTotal << ", then ranks '" << evaluatedEvent.desiredMatrixName() << "' "
+             << walkForwardStep.evaluatedRank << " of " << evaluatedEvent.matrixDigraphsCount() << " in '"
+             << evaluatedEvent.name() << "'.\n";
+    }
+  }
+
+  /** Walk-forward mode: train on each window of consecutive events and evaluate the event following it, the
+      windows being split into independent chains trained concurrently, each with its own share of the training
+      threads. Then log the aggregated evaluations, and save the weights trained on the latest window.
+  */
+  void walkForward(Logger& logger)
+  {
+    myAlive = true;
+
+    auto const stepsCount{ static_cast<Index>(myWalkForwardEvents.size()) - myWalkForwardWindow };
+    auto const chainsCount{ static_cast<Index>(myWalkForwardWeightsCrafterPointers.size()) };
+    logger << "\n● Will walk forward through " << stepsCount << " windows of " << myWalkForwardWindow
+           << " events in " << chainsCount << " chains, training each window for UP TO " << myMaximumTrainingCyclesCount
+           << " cycles...\n";
+
+    // Each chain gets contiguous windows and a share of the training threads, the leading ones the remainders.
+    std::vector<WalkForwardStep> walkForwardSteps(stepsCount);
+    std::mutex loggerMutex;
+    std::vector<std::thread> chainThreads;
+    Index endStepIndex{ 0 };
+    for (Index chainIndex{ 0 }; chainIndex != chainsCount; ++chainIndex) {
+      auto const firstStepIndex{ endStepIndex };
+      endStepIndex += (stepsCount / chainsCount) + ((chainIndex < (stepsCount % chainsCount)) ? 1 : 0);
+      auto const goferThreadsCount{ std::max(
+        (myTrainingThreadsCount / chainsCount) + ((chainIndex < (myTrainingThreadsCount % chainsCount)) ? 1 : 0),
+        Index{ 1 }) };
+      chainThreads.emplace_back(&SupervisedNetworkTrainer::walkForwardChain,
+                                this,
+                                std::ref(logger),
+                                std::ref(loggerMutex),
+                                std::cref(myWalkForwardWeightsCrafterPointers[chainIndex]),
+                                goferThreadsCount,
+                                firstStepIndex,
+                                endStepIndex,
+                                std::ref(walkForwardSteps));
+    }
+    for (auto&& chainThread : chainThreads)
+      chainThread.join();
+
+    // Aggregate the evaluated ranks.
+    std::vector<Index> evaluatedRanks;
+    for (auto const& walkForwardStep : walkForwardSteps)
+      if (walkForwardStep.evaluatedRank != InvalidIndex)
+        evaluatedRanks.push_back(walkForwardStep.evaluatedRank);
+    logger << "\n● Walked forward through " << evaluatedRanks.size() << " of " << stepsCount << " windows.\n";
+    if (not evaluatedRanks.empty()) {
+      std::sort(evaluatedRanks.begin(), evaluatedRanks.end());
+      auto const ranksSum{ std::accumulate(evaluatedRanks.cbegin(), evaluatedRanks.cend(), uint64_t{ 0 }) };
+      logger << "  ∙ The evaluated ranks average " << (static_cast<double>(ranksSum) / evaluatedRanks.size())
+             << ", with a median of " << evaluatedRanks[evaluatedRanks.size() / 2] << ", a best of "
+             << evaluatedRanks.front() << " and a worst of " << evaluatedRanks.back() << ".\n";
+    }
+
+    // The last chain's weights were trained on the latest window, if it was reached.
+    if (walkForwardSteps.back().evaluatedRank != InvalidIndex) {
+      logger << "\n● Saving the weights trained on the latest window...\n  ∙ ";
+      myWalkForwardWeightsCrafterPointers.back()->writeWeightsToFile(logger);
+    }
+
+    myAlive = false;
+  }
+
+  /// Write the trace recorded, if any, to its file.
+  void writeTrace(Logger& logger) const
+  {
+    if (not myTraceRecorderPointer)
+      return;
+
+    logger << "\n● Writing the trace...\n  ∙ ";
+    std::ofstream traceFile(myTraceFileName, std::ios::trunc);
+    if (traceFile.good()) {
+      myTraceRecorderPointer->writeChromeTraceOn(traceFile);
+      if (traceFile.good()) {
+        logger << myTraceRecorderPointer->recordedSpansCount() << " spans were written to file '" << myTraceFileName
+               << "'";
+        if (auto const droppedSpansCount{ myTraceRecorderPointer->droppedSpansCount() })
+          logger << ", the " << droppedSpansCount << " later ones being dropped";
+        logger << ".\n";
+      } else
+        logger.streamCondition(traceFile) << "Writing to file '" << myTraceFileName << "'.\n\n";
+    } else
+      logger.streamCondition(traceFile) << "Can not create/open file '" << myTraceFileName << "' for writing.\n\n";
+  }
+
+  void train(Logger& logger)
+  {
+    myAlive = true;
+    myLoadCheckTime = std::chrono::steady_clock::now();
+
+    logger << "\n● Will train for UP TO " << myMaximumTrainingCyclesCount << " cycles...\n";
+
+    if (myTrainingRuns.size() == 1)
+      trainSingleRun(logger);
+    else
+      trainPortfolio(logger);
 
     logger << "\n● Saving weights...\n  ∙ ";
-    myWeightsCrafterPointer->bringBackBestWeights();
-    myWeightsCrafterPointer->writeWeightsToFile(logger);
+    auto& weightsCrafter{ myTrainingRuns[0]->weightsCrafter() };
+    weightsCrafter.bringBackBestWeights();
+    weightsCrafter.writeWeightsToFile(logger);
+
+    // Continual mode: resume training from the best weights, with the new events, until stopped.
+    if (not myContinualControlFileName.empty())
+      while (myEventsAppendingIsRequested or waitForEventsAppendingRequest(logger)) {
+        if (not appendEvents(logger))
+          continue;
+
+        logger << "\n● Will train for UP TO " << myMaximumTrainingCyclesCount << " more cycles...\n";
+        trainSingleRun(logger);
+
+        logger << "\n● Saving weights...\n  ∙ ";
+        weightsCrafter.bringBackBestWeights();
+        weightsCrafter.writeWeightsToFile(logger);
+      }
 
     myAlive = false;
   }
@@ -740,8 +2216,8 @@ private:
   // PUBLIC INSTANCE METHODS //
 public:
   /** @param[in] logger Logger.
-      @param[in] argumentsCount #main's argc.
-      @param[in] arguments #main's argv.
+      @param[in] allArgumentsCount #main's argc.
+      @param[in] allArguments #main's argv. Arguments of form '--<option>=<value>' may be placed anywhere.
       @param[in] matrixDigraphsMap MatrixDigraphsMap containing a map of
                  matrix digraph type name to the corresponding instantiator.
       @param[in] weightsCraftersMap WeightsCraftersMap containing a map of
@@ -749,36 +2225,76 @@ public:
       @return True on success else false, and log errors.
   */
   bool populateFromArguments(Logger& logger,
-                             int const argumentsCount,
-                             char const* const* const arguments,
+                             int const allArgumentsCount,
+                             char const* const* const allArguments,
                              MatrixDigraphsMap const& matrixDigraphsMap,
                              WeightsCraftersMap const& weightsCraftersMap)
   {
+    // Separate the '--<option>=<value>' options from the positional arguments.
+    std::vector<char const*> positionalArguments;
+    std::map<std::string, std::string> options;
+    for (auto index{ 0 }; index != allArgumentsCount; ++index) {
+      std::string const argument{ allArguments[index] };
+      if (index and (argument.rfind("--", 0) == 0)) {
+        auto const equalPosition{ argument.find('=') };
+        options[argument.substr(2, equalPosition - 2)] =
+          (equalPosition == std::string::npos) ? std::string() : argument.substr(equalPosition + 1);
+      } else
+        positionalArguments.push_back(allArguments[index]);
+    }
+    auto const argumentsCount{ static_cast<int>(positionalArguments.size()) };
+    auto const arguments{ positionalArguments.data() };
+
     // When there is more than one matrix digraph type, we will make them selectable at run time on the command line.
     if (matrixDigraphsMap.size() != 1)
       throw std::logic_error(String(+"matrixDigraphsMap's size is not 1 in: ", +__PRETTY_FUNCTION__, '.'));
     auto const& matrixDigraphName{ matrixDigraphsMap.cbegin()->first };
-    auto const& matrixDigraphInstantiator{ matrixDigraphsMap.cbegin()->second };
+    myMatrixDigraphInstantiator = matrixDigraphsMap.cbegin()->second;
 
-    // When there is more then one weights crafter type, we will make them selectable at run time on the command line.
-    if (weightsCraftersMap.size() != 1)
-      throw std::logic_error(String(+"weightsCraftersMap's size is not 1 in: ", +__PRETTY_FUNCTION__, '.'));
-    auto const& weightsCrafterName{ weightsCraftersMap.cbegin()->first };
-    auto const& weightsCrafterInstantiator{ weightsCraftersMap.cbegin()->second };
+    // The weights crafter type is selectable at run time with option --crafter, defaulting to the first one.
+    if (weightsCraftersMap.empty())
+      throw std::logic_error(String(+"weightsCraftersMap is empty in: ", +__PRETTY_FUNCTION__, '.'));
+    auto weightsCrafterIterator{ weightsCraftersMap.cbegin() };
 
     // Check if matrixDigraphInstantiator is callable.
-    if (not matrixDigraphInstantiator)
+    if (not myMatrixDigraphInstantiator)
       throw std::logic_error(String(+"matrixDigraphInstantiator is not callable in: ", +__PRETTY_FUNCTION__, '.'));
-    // Check if weightsCrafterInstantiator is callable.
-    if (not weightsCrafterInstantiator)
-      throw std::logic_error(String(+"weightsCrafterInstantiator is not callable in: ", +__PRETTY_FUNCTION__, '.'));
-
     auto const logUsage{ [&]() {
       logger << "Usage: " << arguments[0] << '\n'
              << "       <maximum number of training cycles>\n"
-             << "       <number of training threads, 0 for hardware threads ÷ 2>\n"
+             << "       <number of training threads, 0 for the CPU budget>\n"
              << "       [ <desired matrix name>  <event file name>  ]+\n"
-             << "       [ <weights file name> ]\n";
+             << "       [ <weights file name> ]\n"
+             << "Options, anywhere:\n"
+             << "       --columns=<column index>[,<column index>]+   Keep only these event file columns, in order.\n"
+             << "       --continual=<control file name>              Append the events it lists on each SIGUSR1.\n"
+             << "       --crafter=<weights crafter name>             One of:";
+      for (auto const& [name, instantiator] : weightsCraftersMap)
+        logger << " '" << name << '\'';
+      logger << ".\n"
+             << "       --elastic=<control file name>|load           Resize on each SIGUSR2, or following the load.\n"
+             << "       --event-weights=<weight>[,<weight>]+         Count each event's rank this many times.\n"
+             << "       --margins                                    Break ranks ties with the margins above them.\n"
+             << "       --restarts=<runs count>                      Train independently seeded runs concurrently.\n"
+             << "       --thread-statistics                          Log how the training threads spend their time.\n"
+             << "       --top=<ranks count>                          Count all the ranks beyond the top ones alike.\n"
+             << "       --trace=<trace file name>                    Write a Chrome trace of the training once done.\n"
+             << "       --transfer-weights                           Transfer a weights file of another rows count.\n"
+             << "       --walk-forward=<window>[,<chains count>]     Train on each window, evaluate the next event.\n";
+    } };
+
+    // Extract a comma-separated list of indexes, throw on error.
+    auto const extractIndexes{ [](std::string const& list) {
+      std::vector<Index> indexes;
+      std::istringstream listStream(list);
+      for (std::string item; std::getline(listStream, item, ',');) {
+        std::size_t position;
+        auto const value{ std::stoul(item, &position) };
+        if ((position != item.size()) or (value >= InvalidIndex))
+          throw false;
+        indexes.push_back(static_cast<Index>(value));
+      }
+      return indexes;
     } };
 
     // Validate the number of parameters passed.
@@ -790,11 +2306,208 @@ public:
     Index const eventFilesCount{ static_cast<Index>((argumentsCount - 3) / 2) };
 
     // Output back all arguments.
-    for (auto index{ 0 }; index != argumentsCount; ++index)
-      logger << '\'' << arguments[index] << "'  ";
+    for (auto index{ 0 }; index != allArgumentsCount; ++index)
+      logger << '\'' << allArguments[index] << "'  ";
 
     logger << "\n\n● Parsing the command line arguments...\n  ∙ Matrix digraph name is '" << matrixDigraphName
-           << "'.\n  ∙ Weights crafter name is '" << weightsCrafterName << "'.\n";
+           << "'.\n";
+
+    // Extract the options.
+    Index restartsCount{ 1 };
+    bool marginsAreUsed{ false };
+    bool goferThreadsAreInstrumented{ false };
+    std::vector<Index> eventWeights(eventFilesCount, 1);
+    bool weightsAreTransferred{ false };
+    Index walkForwardChainsCount{ 0 };
+    for (auto const& [optionName, optionValue] : options) {
+      if (optionName == "columns") {
+        try {
+          myColumnIndexes = extractIndexes(optionValue);
+          if (myColumnIndexes.size() < 2)
+            throw false;
+        } catch (...) {
+          logger.error() << "Option --columns must list at least 2 comma-separated column indexes, not '"
+                         << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        logger << "  ∙ Only columns";
+        for (auto const columnIndex : myColumnIndexes)
+          logger << ' ' << columnIndex;
+        logger << " of the event files will be kept.\n";
+      } else if (optionName == "restarts") {
+        try {
+          std::size_t position;
+          auto const value{ std::stoul(optionValue, &position) };
+          if ((position != optionValue.size()) or (value < 1) or (value > MaximumRestartsCount))
+            throw false;
+          restartsCount = static_cast<Index>(value);
+        } catch (...) {
+          logger.error() << "Option --restarts must be between 1 and " << MaximumRestartsCount << ", not '"
+                         << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        logger << "  ∙ " << restartsCount
+               << " independently seeded runs will train concurrently, abandoning the trailing ones.\n";
+      } else if (optionName == "event-weights") {
+        try {
+          eventWeights = extractIndexes(optionValue);
+          if (eventWeights.size() != eventFilesCount)
+            throw false;
+          for (auto const eventWeight : eventWeights)
+            if ((eventWeight < 1) or (eventWeight > MaximumEventWeight))
+              throw false;
+        } catch (...) {
+          logger.error() << "Option --event-weights must list " << eventFilesCount
+                         << " comma-separated weights between 1 and " << MaximumEventWeight
+                         << ", one per event file, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        logger << "  ∙ The ranks of the event files will be weighted by";
+        for (auto const eventWeight : eventWeights)
+          logger << ' ' << eventWeight;
+        logger << ".\n";
+      } else if (optionName == "top") {
+        try {
+          std::size_t position;
+          auto const value{ std::stoul(optionValue, &position) };
+          if ((position != optionValue.size()) or (value < 1) or (value >= (InvalidIndex - 1)))
+            throw false;
+          myRankCap = static_cast<Index>(value + 1);
+        } catch (...) {
+          logger.error() << "Option --top must be a positive ranks count, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        logger << "  ∙ The ranks beyond the top " << (myRankCap - 1) << " will all count as " << myRankCap << ".\n";
+      } else if (optionName == "transfer-weights") {
+        if (not optionValue.empty()) {
+          logger.error() << "Option --transfer-weights takes no value, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        weightsAreTransferred = true;
+        logger << "  ∙ A weights file for matrices of another rows count will be transferred.\n";
+      } else if (optionName == "margins") {
+        if (not optionValue.empty()) {
+          logger.error() << "Option --margins takes no value, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        marginsAreUsed = true;
+        logger << "  ∙ Ranks ties will be broken by the margins of the matrices ranking above the desired ones.\n";
+      } else if (optionName == "thread-statistics") {
+        if (not optionValue.empty()) {
+          logger.error() << "Option --thread-statistics takes no value, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        goferThreadsAreInstrumented = true;
+        logger << "  ∙ How the training threads spend their time will be logged with each summary.\n";
+      } else if (optionName == "walk-forward") {
+        try {
+          auto const values{ extractIndexes(optionValue) };
+          if ((values.size() < 1) or (values.size() > 2) or (values[0] < 1) or (values[0] >= eventFilesCount))
+            throw false;
+          myWalkForwardWindow = values[0];
+          walkForwardChainsCount = (values.size() == 2) ? values[1] : 1;
+          if ((walkForwardChainsCount < 1) or (walkForwardChainsCount > (eventFilesCount - myWalkForwardWindow)))
+            throw false;
+        } catch (...) {
+          logger.error() << "Option --walk-forward must be a window of fewer events than the " << eventFilesCount
+                         << " event files, optionally followed by a chains count not above the windows count, not '"
+                         << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        logger << "  ∙ Will walk forward through the event files, in order, by windows of " << myWalkForwardWindow
+               << " in " << walkForwardChainsCount << " chains.\n";
+      } else if (optionName == "continual") {
+        if (optionValue.empty()) {
+          logger.error() << "Option --continual must name a control file.\n\n";
+          logUsage();
+
+          return false;
+        }
+        myContinualControlFileName = optionValue;
+        logger << "  ∙ On signal SIGUSR1, the new events listed in file '" << myContinualControlFileName
+               << "' will be appended.\n";
+      } else if (optionName == "elastic") {
+        if (optionValue.empty()) {
+          logger.error() << "Option --elastic must name a control file, or be 'load'.\n\n";
+          logUsage();
+
+          return false;
+        }
+        if (optionValue == "load") {
+          myElasticModeFollowsLoad = true;
+          logger << "  ∙ The training threads will be resized every " << ElasticLoadCheckSecondsCount
+                 << " seconds, following the load of the machine.\n";
+        } else {
+          myElasticControlFileName = optionValue;
+          logger << "  ∙ On signal SIGUSR2, the training threads will be resized to the number held by file '"
+                 << myElasticControlFileName << "'.\n";
+        }
+      } else if (optionName == "trace") {
+        if (optionValue.empty()) {
+          logger.error() << "Option --trace must name a trace file.\n\n";
+          logUsage();
+
+          return false;
+        }
+        myTraceFileName = optionValue;
+        myTraceRecorderPointer = std::make_shared<TraceRecorder>(TraceSpansCapacity);
+        logger << "  ∙ The first " << TraceSpansCapacity
+               << " spans of the training cycles, barriers, weights crafter steps and errands will be written to file '"
+               << myTraceFileName << "' as Chrome trace-event JSON.\n";
+      } else if (optionName == "crafter") {
+        if ((weightsCrafterIterator = weightsCraftersMap.find(optionValue)) == weightsCraftersMap.cend()) {
+          logger.error() << "Option --crafter must name a known weights crafter, not '" << optionValue << "'.\n\n";
+          logUsage();
+
+          return false;
+        }
+      } else {
+        logger.error() << "Unknown option '--" << optionName << "'.\n\n";
+        logUsage();
+
+        return false;
+      }
+    }
+
+    // Continual mode appends the events to a single training run.
+    if ((not myContinualControlFileName.empty()) and (restartsCount > 1)) {
+      logger.error() << "Option --continual can not be combined with option --restarts.\n\n";
+      logUsage();
+
+      return false;
+    }
+    // Walk-forward mode trains its own runs.
+    if (myWalkForwardWindow and ((restartsCount > 1) or (not myContinualControlFileName.empty()) or
+                                 myElasticModeFollowsLoad or (not myElasticControlFileName.empty()) or
+                                 goferThreadsAreInstrumented)) {
+      logger.error() << "Option --walk-forward can not be combined with options --restarts, --continual, --elastic or "
+                        "--thread-statistics.\n\n";
+      logUsage();
+
+      return false;
+    }
+
+    auto const& [weightsCrafterName, weightsCrafterInstantiator]{ *weightsCrafterIterator };
+    // Check if weightsCrafterInstantiator is callable.
+    if (not weightsCrafterInstantiator)
+      throw std::logic_error(String(+"weightsCrafterInstantiator is not callable in: ", +__PRETTY_FUNCTION__, '.'));
+    logger << "  ∙ Weights crafter name is '" << weightsCrafterName << "'.\n";
 
     // Extract the maximum number of training cycles.
     try {
@@ -831,7 +2544,15 @@ public:
     if (trainingThreadsCount)
       logger << trainingThreadsCount << ".\n";
     else
-      logger << "hardware threads ÷ 2.\n";
+      logger << GoferThreadsPool::defaultGoferThreadsCount()
+             << ", from the CPU budget if restricted by a cgroup, else hardware threads ÷ 2.\n";
+    auto const [cpusCount, hardwareThreadsCount, cpusetCpusCount, quotaCpusCount]{ CpuBudget() };
+    logger << "  ∙ CPU budget is " << cpusCount << " CPUs: " << hardwareThreadsCount << " hardware threads";
+    if (cpusetCpusCount)
+      logger << ", a cpuset of " << cpusetCpusCount << " CPUs";
+    if (quotaCpusCount > 0)
+      logger << ", a quota of " << quotaCpusCount << " CPUs";
+    logger << ".\n";
 
     // Extract the number of pairs of event file name and desired matrix name.
     logger << "  ∙ The desired matrix name in each of the " << eventFilesCount << " event files are:\n";
@@ -846,34 +2567,21 @@ public:
 
     // Create the supervised network events.
     logger << "\n● Creating " << eventFilesCount << " supervised network events...\n";
-    mySupervisedNetworkEvents.resize(eventFilesCount);
+    std::vector<SupervisedNetworkEvent> supervisedNetworkEvents(eventFilesCount);
     for (Index index{ 0 }; index != eventFilesCount; ++index) {
-      auto const desiredMatrixName{ arguments[(index * 2) + 3] };
-      auto const eventFileName{ arguments[(index * 2) + 4] };
-      logger << "  ∙ Parsing event file '" << eventFileName << "'...\n";
-
-      // Open the event file in binary reading mode.
-      auto eventFileStatus{ OpenInputBinaryFileNamed(eventFileName) };
-      auto const& [eventFile, errorMessage, eventFileSize] = eventFileStatus;
-      if (not eventFile.good()) {
-        logger.streamCondition(eventFile) << errorMessage << "\n\n";
-        return false;
-      }
-
-      // Build a new matrix digraph.
-      if (not mySupervisedNetworkEvents[index].buildMatrixDigraphs(
-            logger, desiredMatrixName, eventFileStatus, matrixDigraphInstantiator))
+      if (not buildSupervisedNetworkEvent(
+            logger, arguments[(index * 2) + 3], arguments[(index * 2) + 4], supervisedNetworkEvents[index]))
         return false;
-      mySupervisedNetworkEvents[index].setName(eventFileName);
+      supervisedNetworkEvents[index].setRankWeight(eventWeights[index]);
     }
 
     // Verify that all weights count are equal, and not 0.
-    decltype(mySupervisedNetworkEvents[0].requiredWeightsCount()) commonRequiredWeightsCount{ 0 };
+    decltype(supervisedNetworkEvents[0].requiredWeightsCount()) commonRequiredWeightsCount{ 0 };
     for (Index index{ 0 }; index != eventFilesCount; ++index) {
-      auto const currentRequiredWeightsCount{ mySupervisedNetworkEvents[index].requiredWeightsCount() };
+      auto const currentRequiredWeightsCount{ supervisedNetworkEvents[index].requiredWeightsCount() };
       if (not currentRequiredWeightsCount)
         throw std::logic_error(String(+"requiredWeightsCount() is 0 for SupervisedNetworkEvent '",
-                                      mySupervisedNetworkEvents[index].name(),
+                                      supervisedNetworkEvents[index].name(),
                                       +"' in: ",
                                       +__PRETTY_FUNCTION__,
                                       '.'));
@@ -886,44 +2594,114 @@ public:
     }
     logger << "  ∙ Common required weights count is " << commonRequiredWeightsCount << ".\n";
 
+    // The weights regions must be the same for all the events, as they share the required weights count.
+    auto const weightsRegions{ supervisedNetworkEvents[0].weightsRegions() };
+    for (auto const& supervisedNetworkEvent : supervisedNetworkEvents)
+      if (supervisedNetworkEvent.weightsRegions() != weightsRegions) {
+        logger.error() << "Event '" << supervisedNetworkEvent.name()
+                       << "' does not divide its weights into the same regions as the others.\n\n";
+        return false;
+      }
+
+    // Create a weights crafter, populated from the weights file if its name was provided. Null on error.
+    auto const createWeightsCrafter{ [&]() -> WeightsCrafter::WeightsCrafterPointer {
+      WeightsCrafter::WeightsCrafterPointer weightsCrafterPointer;
+      if (not(weightsCrafterPointer = weightsCrafterInstantiator(commonRequiredWeightsCount)))
+        throw std::logic_error(
+          String(+"weightsCrafterInstantiator failed to create a weights crafter in: ", +__PRETTY_FUNCTION__, '.'));
+      weightsCrafterPointer->setWeightsRegions(weightsRegions);
+
+      if (weightsFileName) {
+        // Open the weights file in binary reading mode.
+        auto weightsFileStatus{ OpenInputBinaryFileNamed(weightsFileName) };
+        auto const& [weightsFile, errorMessage, weightsFileSize] = weightsFileStatus;
+        if (not weightsFile.good()) {
+          logger.streamCondition(weightsFile) << errorMessage << "\n\n";
+          return nullptr;
+        }
+
+        std::cout << "  ∙ ";
+        WeightsCrafter::WeightsTransferer weightsTransferer;
+        if (weightsAreTransferred)
+          weightsTransferer = [&supervisedNetworkEvents](auto const& fromWeights, auto& toWeights) {
+            return supervisedNetworkEvents[0].transferWeights(fromWeights, toWeights);
+          };
+        if (not weightsCrafterPointer->readWeightsFromFile(logger, weightsFileStatus, weightsTransferer))
+          return nullptr;
+      }
+
+      return weightsCrafterPointer;
+    } };
+
     // Create the weights crafter.
     if (weightsFileName)
       logger << "\n● Creating the weights crafter parsing file '" << weightsFileName << "'...\n";
     else
       logger << "\n● Creating the randomized weights crafter...\n";
+    logger << "  ∙ The weights are divided into " << weightsRegions.size() << " regions.\n";
+    auto const weightsCrafterPointer{ createWeightsCrafter() };
+    if (not weightsCrafterPointer)
+      return false;
+    auto const sharedTrainingThreadsCount{
+      trainingThreadsCount ? static_cast<Index>(trainingThreadsCount)
+                           : static_cast<Index>(GoferThreadsPool::defaultGoferThreadsCount())
+    };
 
-    if (not(myWeightsCrafterPointer = weightsCrafterInstantiator(commonRequiredWeightsCount)))
-      throw std::logic_error(
-        String(+"weightsCrafterInstantiator failed to create a weights crafter in: ", +__PRETTY_FUNCTION__, '.'));
-
-    // Populate the weights crafter if a file name was provided.
-    if (weightsFileName) {
-      // Open the weights file in binary reading mode.
-      auto weightsFileStatus{ OpenInputBinaryFileNamed(weightsFileName) };
-      auto const& [weightsFile, errorMessage, weightsFileSize] = weightsFileStatus;
-      if (not weightsFile.good()) {
-        logger.streamCondition(weightsFile) << errorMessage << "\n\n";
-        return false;
+    // Walk-forward mode keeps the loaded events, and one independently seeded weights crafter per chain.
+    if (myWalkForwardWindow) {
+      myWalkForwardWeightsCrafterPointers.push_back(weightsCrafterPointer);
+      if (walkForwardChainsCount > 1) {
+        logger << "\n● Creating " << (walkForwardChainsCount - 1) << " more weights crafters for the chains...\n";
+        for (Index index{ 1 }; index != walkForwardChainsCount; ++index)
+          if (not myWalkForwardWeightsCrafterPointers.emplace_back(createWeightsCrafter()))
+            return false;
       }
+      for (auto&& supervisedNetworkEvent : supervisedNetworkEvents)
+        supervisedNetworkEvent.computeMargins(marginsAreUsed);
+      myWalkForwardEvents = std::move(supervisedNetworkEvents);
+      myTrainingThreadsCount = sharedTrainingThreadsCount;
 
-      std::cout << "  ∙ ";
-      if (not myWeightsCrafterPointer->readWeightsFromFile(logger, weightsFileStatus))
-        return false;
+      logger << '\n';
+      return true;
+    }
+
+    // Each other restart portfolio run gets deep copies of the events and its own independently seeded crafter.
+    std::vector<std::vector<SupervisedNetworkEvent>> otherSupervisedNetworkEvents(restartsCount - 1,
+                                                                                  supervisedNetworkEvents);
+    std::vector<WeightsCrafter::WeightsCrafterPointer> otherWeightsCrafterPointers;
+    if (restartsCount > 1) {
+      logger << "\n● Creating " << (restartsCount - 1) << " more weights crafters for the restart portfolio...\n";
+      for (Index index{ 1 }; index != restartsCount; ++index)
+        if (not otherWeightsCrafterPointers.emplace_back(createWeightsCrafter()))
+          return false;
     }
 
-    // Assign the newly created weights crafter to all supervised network events.
+    // Assign the newly created weights crafters to the supervised network events.
     logger << "  ∙ Assigning the weights crafter to the supervised network events...\n";
-    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
-      supervisedNetworkEvent.useWeightsCrafter(myWeightsCrafterPointer);
+    myTrainingRuns.push_back(
+      std::make_unique<SupervisedNetworkTrainingRun>(std::move(supervisedNetworkEvents), weightsCrafterPointer));
+    for (Index index{ 1 }; index != restartsCount; ++index)
+      myTrainingRuns.push_back(std::make_unique<SupervisedNetworkTrainingRun>(
+        std::move(otherSupervisedNetworkEvents[index - 1]), otherWeightsCrafterPointers[index - 1]));
+    for (auto&& trainingRunPointer : myTrainingRuns) {
+      trainingRunPointer->useMargins(marginsAreUsed);
+      trainingRunPointer->instrumentGoferThreads(goferThreadsAreInstrumented);
+      trainingRunPointer->traceInto(myTraceRecorderPointer);
+    }
 
     // Create, or not, the gofer threads.
     if (myMaximumTrainingCyclesCount > 1) {
-      if (trainingThreadsCount == 1)
+      myTrainingThreadsCount = sharedTrainingThreadsCount;
+      if (myTrainingRuns.size() > 1) {
+        logger << "\n● Sharing " << myTrainingThreadsCount << " training threads among " << myTrainingRuns.size()
+               << " restart portfolio runs...\n";
+        shareTrainingThreads(logger);
+      } else if (myTrainingThreadsCount == 1)
         logger << "\n● The training will be done on the main thread.\n";
       else {
         logger << "\n● Spawning the training threads...\n";
-        myGoferThreadsPoolPointer = std::make_unique<GoferThreadsPool>(trainingThreadsCount);
-        logger << "  ∙ " << myGoferThreadsPoolPointer->goferThreadsCount() << " training threads were spawned.\n";
+        myTrainingRuns[0]->useGoferThreadsCount(myTrainingThreadsCount, &logger);
+        logger << "  ∙ " << myTrainingRuns[0]->goferThreadsCount() << " training threads were spawned.\n";
       }
     }
 
@@ -934,19 +2712,37 @@ public:
   /// To be called asynchronously to stop training.
   void stop() noexcept { myAlive = false; }
 
+  /// To be called asynchronously to append the events listed in the continual mode's control file.
+  void requestEventsAppending() noexcept { myEventsAppendingIsRequested = true; }
+  /// @return Empty if not in continual mode.
+  decltype(auto) continualControlFileName() const noexcept { return myContinualControlFileName; }
+
+  /// To be called asynchronously to resize the training threads to the number held by the elastic mode's file.
+  void requestResizing() noexcept { myResizingIsRequested = true; }
+  /// @return Empty if not in elastic mode, or if following the load.
+  decltype(auto) elasticControlFileName() const noexcept { return myElasticControlFileName; }
+
   void run(Logger& logger)
   {
+    if (myWalkForwardWindow) {
+      walkForward(logger);
+      writeTrace(logger);
+      logger << '\n';
+      return;
+    }
+
     if (myMaximumTrainingCyclesCount > 1)
       train(logger);
+    writeTrace(logger);
 
-    //  Apply the (best) weights to all the non-input values, either one last time or once.
-    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents)
-      supervisedNetworkEvent.applyWeights();
+    //  Apply the (best) weights to all the non-input values, either one last time or once, and keep them.
+    auto& trainingRun{ *myTrainingRuns[0] };
+    trainingRun.finish();
     logger << "\n● The final ranks are:\n";
-    logRanks(logger);
+    trainingRun.logRanks(logger);
 
     logger << "\n● The final ordered names are:\n";
-    for (auto&& supervisedNetworkEvent : mySupervisedNetworkEvents) {
+    for (auto&& supervisedNetworkEvent : trainingRun.supervisedNetworkEvents()) {
       supervisedNetworkEvent.reverseSortMatrixDigraphsByUniqueSinkValue();
       logger << "  ∙ ";
       supervisedNetworkEvent.logUniqueSinkValues(logger);
@@ -32,13 +32,17 @@
 **************
 */
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <ctime>
+#include <deque>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -55,6 +59,10 @@
 #include <typeinfo>
 #include <utility>
 #include <vector>
+// Only if compiled as C++20, see GoferThreadsPool::Task.
+#if defined(__cpp_impl_coroutine) and __has_include(<coroutine>)
+#include <coroutine>
+#endif
 
 /*
 *****************
@@ -230,6 +238,115 @@ TypeNameOf(Object const& object)
   return TypeNameOfTypeID(typeid(object));
 }
 
+/** CPU budget of this process, as in a container std::thread::hardware_concurrency() is the host's while its cgroup
+    (v1 or v2) may restrict it to a cpuset and a CPU quota. Detected once, on Linux, else only hardware threads.
+    Returns std::tuple {unsigned int cpusCount, unsigned int hardwareThreadsCount, unsigned int cpusetCpusCount,
+    double quotaCpusCount}, where cpusetCpusCount and quotaCpusCount are 0 if not detected, and cpusCount is the
+    smallest of the three, the quota being rounded down as exceeding it gets throttled, but at least 1.
+*/
+static decltype(auto)
+CpuBudget()
+{
+  static auto const cpuBudget{ []() {
+    constexpr static auto const CgroupsDirectoryName{ "/sys/fs/cgroup" };
+
+    // First line of the first readable file, else empty.
+    auto const firstLineOf{ [](std::vector<std::string> const& fileNames) {
+      std::string line;
+      for (auto const& fileName : fileNames) {
+        std::ifstream file(fileName);
+        if (std::getline(file, line))
+          break;
+      }
+      return line;
+    } };
+    // Within its cgroup namespace, a container's own cgroup is mounted as the root, so also look there.
+    auto const fileNamesOf{ [](std::string const& directoryName, std::string const& path, char const* fileName) {
+      return std::vector<std::string>{ directoryName + path + '/' + fileName, directoryName + '/' + fileName };
+    } };
+    // Count of CPUs in a cpuset list, e.g. "0-3,8,10-11", else 0.
+    auto const cpusetCpusCountOf{ [](std::string const& cpusList) {
+      unsigned int cpusCount{ 0 };
+      std::istringstream cpusRanges(cpusList);
+      try {
+        for (std::string cpusRange; std::getline(cpusRanges, cpusRange, ',');) {
+          auto const dashIndex{ cpusRange.find('-') };
+          auto const firstCpu{ std::stoul(cpusRange.substr(0, dashIndex)) };
+          auto const lastCpu{ (dashIndex == std::string::npos) ? firstCpu
+                                                               : std::stoul(cpusRange.substr(dashIndex + 1)) };
+          if (lastCpu >= firstCpu)
+            cpusCount += static_cast<unsigned int>(lastCpu - firstCpu + 1);
+        }
+      } catch (...) {
+        return 0U;
+      }
+      return cpusCount;
+    } };
+
+    // This process's cgroups paths, from lines e.g. "0::/user.slice" (v2) or "4:cpu,cpuacct:/docker/1f2e" (v1).
+    std::string unifiedPath, cpuPath, cpusetPath;
+    std::ifstream cgroupsFile("/proc/self/cgroup");
+    for (std::string line; std::getline(cgroupsFile, line);) {
+      auto const firstColonIndex{ line.find(':') };
+      auto const secondColonIndex{ line.find(':', firstColonIndex + 1) };
+      if ((firstColonIndex == std::string::npos) or (secondColonIndex == std::string::npos))
+        continue;
+      auto const controllers{ ',' + line.substr(firstColonIndex + 1, secondColonIndex - firstColonIndex - 1) + ',' };
+      auto const path{ line.substr(secondColonIndex + 1) };
+      if (controllers == ",,")
+        unifiedPath = path;
+      if (controllers.find(",cpu,") != std::string::npos)
+        cpuPath = path;
+      if (controllers.find(",cpuset,") != std::string::npos)
+        cpusetPath = path;
+    }
+
+    double quotaCpusCount{ 0 };
+    try {
+      // v2: "max 100000" if unlimited, else "<quota> <period>" in microseconds.
+      if (auto const cpuMax{ firstLineOf(fileNamesOf(CgroupsDirectoryName, unifiedPath, "cpu.max")) };
+          not cpuMax.empty()) {
+        std::istringstream cpuMaxStream(cpuMax);
+        std::string quota;
+        double period{ 0 };
+        if ((cpuMaxStream >> quota >> period) and (quota != "max") and (period > 0))
+          quotaCpusCount = std::stod(quota) / period;
+      } else
+        // v1: a quota of -1 if unlimited.
+        for (std::string const directoryName : { "/sys/fs/cgroup/cpu,cpuacct", "/sys/fs/cgroup/cpu" })
+          if (auto const quota{ firstLineOf(fileNamesOf(directoryName, cpuPath, "cpu.cfs_quota_us")) };
+              not quota.empty()) {
+            auto const period{ std::stod(firstLineOf(fileNamesOf(directoryName, cpuPath, "cpu.cfs_period_us"))) };
+            if ((std::stod(quota) > 0) and (period > 0))
+              quotaCpusCount = std::stod(quota) / period;
+            break;
+          }
+    } catch (...) {
+      quotaCpusCount = 0;
+    }
+
+    auto cpusList{ firstLineOf(fileNamesOf(CgroupsDirectoryName, unifiedPath, "cpuset.cpus.effective")) };
+    if (cpusList.empty())
+      cpusList = firstLineOf({ std::string(CgroupsDirectoryName) + "/cpuset" + cpusetPath + "/cpuset.effective_cpus",
+                               std::string(CgroupsDirectoryName) + "/cpuset" + cpusetPath + "/cpuset.cpus",
+                               std::string(CgroupsDirectoryName) + "/cpuset/cpuset.effective_cpus",
+                               std::string(CgroupsDirectoryName) + "/cpuset/cpuset.cpus" });
+    auto const cpusetCpusCount{ cpusetCpusCountOf(cpusList) };
+
+    // Real CPU core count is not guaranteed, but at least 1.
+    auto const hardwareThreadsCount{ std::max(std::thread::hardware_concurrency(), 1U) };
+    auto cpusCount{ hardwareThreadsCount };
+    if (cpusetCpusCount)
+      cpusCount = std::min(cpusCount, cpusetCpusCount);
+    if (quotaCpusCount > 0)
+      cpusCount = std::min(cpusCount, std::max(static_cast<unsigned int>(quotaCpusCount), 1U));
+
+    return std::tuple{ cpusCount, hardwareThreadsCount, cpusetCpusCount, quotaCpusCount };
+  }() };
+
+  return cpuBudget;
+}
+
 /*
 ***********
 ** MIXIN **
@@ -458,12 +575,134 @@ public:
 ***********
 */
 
+/** Records named spans of time of any thread, e.g. errands, barriers and training steps, into a buffer preallocated
+    for a maximum number of them, then writes them as Chrome trace-event JSON, as opened by chrome://tracing or
+    Perfetto, to see at a glance which threads straggle or idle.
+    Recording is thread-safe and lock-free: each span claims the next slot, and spans beyond the capacity are only
+    counted as dropped.
+*/
+class TraceRecorder
+{
+  // DEFINITIONS //
+public:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  struct Span
+  {
+    // Must outlive the recorder, e.g. a string literal.
+    char const* name{ nullptr };
+    Clock::time_point beginTime;
+    Clock::time_point endTime;
+    unsigned int threadIndex{ 0 };
+  };
+
+  // INSTANCE VARIABLES //
+private:
+  std::vector<Span> mySpans;
+  // Slots claimed, beyond the capacity once spans are dropped.
+  std::atomic<std::size_t> myClaimedSpansCount{ 0 };
+  Clock::time_point const myCreationTime{ Clock::now() };
+
+  // PRIVATE STATIC METHODS //
+private:
+  /// @return Index of the calling thread, in order of its first span recorded by any recorder.
+  static unsigned int threadIndex() noexcept
+  {
+    static std::atomic<unsigned int> threadsCount{ 0 };
+    thread_local unsigned int const threadIndex{ threadsCount++ };
+    return threadIndex;
+  }
+
+  // PUBLIC INSTANCE METHODS //
+public:
+  /// @param[in] name Must outlive the recorder, e.g. a string literal.
+  void record(char const* const name, Clock::time_point const beginTime, Clock::time_point const endTime) noexcept
+  {
+    if (auto const spanIndex{ myClaimedSpansCount.fetch_add(1, std::memory_order_relaxed) };
+        spanIndex < mySpans.size())
+      mySpans[spanIndex] = { name, beginTime, endTime, threadIndex() };
+  }
+
+  decltype(auto) spansCapacity() const noexcept { return mySpans.size(); }
+  std::size_t recordedSpansCount() const noexcept { return std::min(myClaimedSpansCount.load(), mySpans.size()); }
+  std::size_t droppedSpansCount() const noexcept { return myClaimedSpansCount.load() - recordedSpansCount(); }
+
+  /** Write the recorded spans as complete events, timed in microseconds since the recorder was created, each
+      thread being named after its index.
+      @pre No span is being recorded, e.g. the recording gofer threads pools are idle.
+  */
+  template<typename Char>
+  void writeChromeTraceOn(std::basic_ostream<Char>& outputStream) const
+  {
+    auto const microsecondsOf{ [](Clock::duration const duration) {
+      return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / 1E3;
+    } };
+    auto const spansCount{ recordedSpansCount() };
+    unsigned int threadsCount{ 0 };
+    for (std::size_t spanIndex{ 0 }; spanIndex != spansCount; ++spanIndex)
+      threadsCount = std::max(threadsCount, mySpans[spanIndex].threadIndex + 1);
+
+    auto const flags{ outputStream.flags() };
+    auto const precision{ outputStream.precision() };
+    outputStream << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (unsigned int threadIndex{ 0 }; threadIndex != threadsCount; ++threadIndex)
+      outputStream << (threadIndex ? ",\n" : "\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                   << threadIndex << ",\"args\":{\"name\":\"Thread " << threadIndex << "\"}}";
+    for (std::size_t spanIndex{ 0 }; spanIndex != spansCount; ++spanIndex) {
+      auto const& span{ mySpans[spanIndex] };
+      outputStream << ",\n{\"name\":\"" << span.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << span.threadIndex
+                   << ",\"ts\":" << microsecondsOf(span.beginTime - myCreationTime)
+                   << ",\"dur\":" << microsecondsOf(span.endTime - span.beginTime) << '}';
+    }
+    outputStream << "\n]}\n";
+    outputStream.flags(flags);
+    outputStream.precision(precision);
+  }
+
+  // CONSTRUCTORS //
+public:
+  /// Preallocate spansCapacity spans.
+  explicit TraceRecorder(std::size_t const spansCapacity)
+    : mySpans(spansCapacity)
+  {
+  }
+
+  /// Deleted as threads may be recording into it.
+  TraceRecorder(TraceRecorder const&) = delete;
+  /// Deleted as threads may be recording into it.
+  TraceRecorder(TraceRecorder&&) = delete;
+
+  // ASSIGNMENT OPERATORS //
+public:
+  /// Deleted as threads may be recording into it.
+  TraceRecorder& operator=(TraceRecorder const&) = delete;
+  /// Deleted as threads may be recording into it.
+  TraceRecorder& operator=(TraceRecorder&&) = delete;
+};
+
+/*
+***********
+** CLASS **
+***********
+*/
+
 /** Pool of gofer threads that will eventually run all errands euqueued.
     Errands MUST be thread-safe OR share NO data.
     Each errand must capture by reference ONLY values that are guaranteed to outlive it.
     ABSOLUTELY NO PROTECTION is built-in against errands that will deadlock or not end.
     GoferThreadsPool itself is thread-safe if shared, and ONLY IF not destroyed by a sharer
     while other sharers are still using it.
+    Both the gofer threads waiting for errands and the client threads waiting for their completion first spin for
+    a while, pausing exponentially longer, then park in a condition variable, only notified if someone is parked.
+    The spin duration follows the average errand duration, up to a configurable maximum.
+    Errands may be enqueued in an ErrandsGroup, to be waited for apart from the other errands sharing the pool.
+    Procedures returning a result may be submitted for a std::future, and dependent errands may be enqueued as an
+    ErrandsGraph, each running as soon as its predecessors completed instead of after a full barrier.
+    Low priority errands, e.g. background checkpoints, only run when no high priority errand is queued.
+    The number of gofer threads may be changed at runtime, idle gofer threads retiring when shrinking.
+    Once instrumented, each gofer thread keeps histograms of how long errands were queued and ran, and of its idle time.
+    If compiled as C++20, coroutines may await being scheduled on a gofer thread, or the completion of errands.
 */
 class GoferThreadsPool
 {
@@ -471,21 +710,403 @@ class GoferThreadsPool
 public:
   using ErrandProcedure = std::function<void()>;
 
+  /// Lane in which errands are queued. Low priority errands are only dequeued when no high priority one is queued.
+  enum class ErrandsPriority
+  {
+    High,
+    Low
+  };
+
+  /** Errands enqueued together in a shared pool, e.g. by a trainer and a validator, so as to be waited for apart
+      from the others, optionally running a completion procedure once they all completed.
+      Must outlive its errands, as they point to it. The pool's waits for all errands also wait for its errands.
+  */
+  class ErrandsGroup
+  {
+    friend GoferThreadsPool;
+
+    // INSTANCE VARIABLES //
+  private:
+    // Being run AND still waiting in the pool's queue. Only modified under the pool's mutex.
+    std::atomic<unsigned int> myErrandsLeftCount{ 0 };
+    ErrandProcedure myCompletionProcedure;
+
+    // CONSTRUCTORS //
+  public:
+    ErrandsGroup() = default;
+    /** @param[in] completionProcedure Run by the gofer thread that completed the group's last errand left, before
+        the waits for the group return. Runs again whenever errands enqueued later all complete.
+    */
+    explicit ErrandsGroup(ErrandProcedure&& completionProcedure)
+      : myCompletionProcedure(std::move(completionProcedure))
+    {}
+
+    /// Deleted as errands point to it.
+    ErrandsGroup(ErrandsGroup const&) = delete;
+    /// Deleted as errands point to it.
+    ErrandsGroup(ErrandsGroup&&) = delete;
+
+    // ASSIGNMENT OPERATORS //
+  public:
+    /// Deleted as errands point to it.
+    ErrandsGroup& operator=(ErrandsGroup const&) = delete;
+    /// Deleted as errands point to it.
+    ErrandsGroup& operator=(ErrandsGroup&&) = delete;
+
+    // PUBLIC INSTANCE METHODS //
+  public:
+    decltype(auto) errandsLeftCount() const noexcept { return myErrandsLeftCount.load(); }
+  };
+
+  /** Directed acyclic graph of errands, e.g. load → validate → build → evaluate per file, enqueued at once:
+      each errand is enqueued as soon as all its predecessors completed, so that independent stages overlap.
+      Predecessors must be added first, which keeps the graph acyclic. Must outlive its running errands.
+      May be enqueued again once completed, but not modified while running.
+  */
+  class ErrandsGraph
+  {
+    friend GoferThreadsPool;
+
+    // DEFINITIONS //
+  public:
+    using ErrandIndex = std::size_t;
+
+  private:
+    struct Node
+    {
+      // Empty to only join its predecessors.
+      ErrandProcedure errand;
+      std::vector<ErrandIndex> successorIndexes;
+      unsigned int predecessorsCount{ 0 };
+      std::atomic<unsigned int> predecessorsLeftCount{ 0 };
+    };
+
+    // INSTANCE VARIABLES //
+  private:
+    // A deque as nodes are not movable, holding an atomic.
+    std::deque<Node> myNodes;
+    ErrandsGroup myErrandsGroup;
+
+    // CONSTRUCTORS //
+  public:
+    ErrandsGraph() = default;
+    /// @param[in] completionProcedure Run once all the errands completed, see #ErrandsGroup.
+    explicit ErrandsGraph(ErrandProcedure&& completionProcedure)
+      : myErrandsGroup(std::move(completionProcedure))
+    {}
+
+    // PUBLIC INSTANCE METHODS //
+  public:
+    /** @param[in] errand Thread-safe errand, as for GoferThreadsPool::enQueueErrand(). Empty to only join.
+        @param[in] predecessorIndexes Indexes, returned by previous calls, of the errands to complete first.
+        @return Index of the added errand.
+    */
+    ErrandIndex addErrand(ErrandProcedure&& errand, std::vector<ErrandIndex> const& predecessorIndexes = {})
+    {
+      if (myErrandsGroup.errandsLeftCount())
+        throw std::logic_error(String(+"Running ErrandsGraph modified in: ", +__PRETTY_FUNCTION__, '.'));
+      auto const errandIndex{ myNodes.size() };
+      for (auto const predecessorIndex : predecessorIndexes)
+        if (predecessorIndex >= errandIndex)
+          throw std::logic_error(String(+"Unknown predecessorIndex in: ", +__PRETTY_FUNCTION__, '.'));
+
+      auto& node{ myNodes.emplace_back() };
+      node.errand = std::move(errand);
+      node.predecessorsCount = static_cast<unsigned int>(predecessorIndexes.size());
+      for (auto const predecessorIndex : predecessorIndexes)
+        myNodes[predecessorIndex].successorIndexes.push_back(errandIndex);
+
+      return errandIndex;
+    }
+
+    decltype(auto) errandsCount() const noexcept { return myNodes.size(); }
+    /// Being run AND waiting in the pool's queue. Errands whose predecessors did not complete yet are not counted.
+    decltype(auto) errandsLeftCount() const noexcept { return myErrandsGroup.errandsLeftCount(); }
+  };
+
+#ifdef __cpp_lib_coroutine
+  /** Return type of coroutines awaiting #schedule or #whenAll, e.g. to interleave loading with computing without
+      blocking a thread: started right away on the calling thread, each co_await then resumes it on a gofer thread.
+      Its result, or the exception it threw, is waited for with get() by code that is NOT a coroutine.
+      @post Calling get() from an errand WILL deadlock if all the gofer threads end up doing so.
+  */
+  template<typename Result = void>
+  class Task
+  {
+    // DEFINITIONS //
+  private:
+    template<typename Value, typename = void>
+    struct ResultPromise
+    {
+      std::promise<Value> resultPromise;
+
+      template<typename Returned>
+      void return_value(Returned&& returned)
+      {
+        resultPromise.set_value(std::forward<Returned>(returned));
+      }
+    };
+    template<typename Dummy>
+    struct ResultPromise<void, Dummy>
+    {
+      std::promise<void> resultPromise;
+
+      void return_void() { resultPromise.set_value(); }
+    };
+
+  public:
+    struct promise_type : ResultPromise<Result>
+    {
+      Task get_return_object() { return Task(this->resultPromise.get_future()); }
+      // The coroutine frame is destroyed once done, its result being kept by the future.
+      std::suspend_never initial_suspend() const noexcept { return {}; }
+      std::suspend_never final_suspend() const noexcept { return {}; }
+      void unhandled_exception() { this->resultPromise.set_exception(std::current_exception()); }
+    };
+
+    // INSTANCE VARIABLES //
+  private:
+    std::future<Result> myResultFuture;
+
+    // CONSTRUCTORS //
+  private:
+    explicit Task(std::future<Result>&& resultFuture)
+      : myResultFuture(std::move(resultFuture))
+    {
+    }
+
+    // PUBLIC INSTANCE METHODS //
+  public:
+    decltype(auto) get() { return myResultFuture.get(); }
+    void wait() const { myResultFuture.wait(); }
+  };
+
+  /// Awaitable of #schedule.
+  class ScheduleAwaiter
+  {
+    friend GoferThreadsPool;
+
+    // INSTANCE VARIABLES //
+  private:
+    GoferThreadsPool& myGoferThreadsPool;
+    ErrandsPriority const myErrandsPriority;
+
+    // CONSTRUCTORS //
+  private:
+    ScheduleAwaiter(GoferThreadsPool& goferThreadsPool, ErrandsPriority const errandsPriority) noexcept
+      : myGoferThreadsPool(goferThreadsPool)
+      , myErrandsPriority(errandsPriority)
+    {
+    }
+
+    // PUBLIC INSTANCE METHODS //
+  public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> const coroutineHandle) const
+    {
+      myGoferThreadsPool.privateEnQueueErrand(
+        ErrandProcedure([coroutineHandle]() { coroutineHandle.resume(); }), nullptr, myErrandsPriority);
+    }
+    void await_resume() const noexcept {}
+  };
+
+  /// Awaitable of #whenAll.
+  template<typename Container>
+  class WhenAllAwaiter
+  {
+    friend GoferThreadsPool;
+
+    // INSTANCE VARIABLES //
+  private:
+    GoferThreadsPool& myGoferThreadsPool;
+    Container const& myErrandsContainer;
+    ErrandsPriority const myErrandsPriority;
+    std::coroutine_handle<> myCoroutineHandle;
+    // Plus 1 until all the errands are enqueued, so that the last one to complete resumes the coroutine.
+    std::atomic<std::size_t> myErrandsLeftCount{ 1 };
+
+    // CONSTRUCTORS //
+  private:
+    WhenAllAwaiter(GoferThreadsPool& goferThreadsPool,
+                   Container const& errandsContainer,
+                   ErrandsPriority const errandsPriority) noexcept
+      : myGoferThreadsPool(goferThreadsPool)
+      , myErrandsContainer(errandsContainer)
+      , myErrandsPriority(errandsPriority)
+    {
+    }
+
+    // PUBLIC INSTANCE METHODS //
+  public:
+    bool await_ready() const noexcept { return myErrandsContainer.empty(); }
+    /// @return FALSE to resume the coroutine right away, if the errands all completed while being enqueued.
+    bool await_suspend(std::coroutine_handle<> const coroutineHandle)
+    {
+      myCoroutineHandle = coroutineHandle;
+      std::vector<ErrandProcedure> errands;
+      for (auto const& errand : myErrandsContainer)
+        if (errand)
+          errands.push_back([this, &errand]() {
+            errand();
+            // The coroutine may destroy this awaiter once resumed.
+            if (myErrandsLeftCount.fetch_sub(1) == 1)
+              myCoroutineHandle.resume();
+          });
+      myErrandsLeftCount += errands.size();
+      myGoferThreadsPool.privateEnQueueErrands(errands, false, nullptr, myErrandsPriority);
+
+      return myErrandsLeftCount.fetch_sub(1) != 1;
+    }
+    void await_resume() const noexcept {}
+  };
+#endif
+
+  /// Durations in buckets of powers of 2 nanoseconds: bucket i counts those under 2^i ns, and of at least 2^(i-1).
+  struct DurationsHistogram
+  {
+    // The last bucket counts all those of at least about 39 hours.
+    constexpr static std::size_t const BucketsCount{ 48 };
+
+    std::array<uint64_t, BucketsCount> counts{};
+    uint64_t totalNanoseconds{ 0 };
+
+    static std::size_t bucketIndexOf(uint64_t nanoseconds) noexcept
+    {
+      std::size_t bucketIndex{ 0 };
+      for (; nanoseconds and (bucketIndex != (BucketsCount - 1)); nanoseconds >>= 1)
+        ++bucketIndex;
+      return bucketIndex;
+    }
+
+    uint64_t count() const noexcept
+    {
+      uint64_t count{ 0 };
+      for (auto const bucketCount : counts)
+        count += bucketCount;
+      return count;
+    }
+    double meanNanoseconds() const noexcept
+    {
+      auto const count{ this->count() };
+      return count ? (static_cast<double>(totalNanoseconds) / static_cast<double>(count)) : 0;
+    }
+    /// @return Upper bound of the bucket holding the given fraction of the durations, e.g. 0.99, 0 if none.
+    uint64_t percentileNanoseconds(double const fraction) const noexcept
+    {
+      auto const count{ this->count() };
+      uint64_t cumulatedCount{ 0 };
+      for (std::size_t bucketIndex{ 0 }; bucketIndex != BucketsCount; ++bucketIndex)
+        if (count and ((cumulatedCount += counts[bucketIndex]) >= (fraction * static_cast<double>(count))))
+          return uint64_t{ 1 } << bucketIndex;
+      return 0;
+    }
+  };
+
+  /// What a gofer thread spent its time on since last taken, see #setInstrumented.
+  struct GoferThreadStatistics
+  {
+    // From being enqueued to being dequeued.
+    DurationsHistogram queuedDurations;
+    DurationsHistogram runDurations;
+    // Between errands, spinning or parked.
+    DurationsHistogram idleDurations;
+    bool retired{ false };
+
+    /// @return Share of the time spent running errands rather than idle, 0 if none.
+    double busyShare() const noexcept
+    {
+      auto const totalNanoseconds{ runDurations.totalNanoseconds + idleDurations.totalNanoseconds };
+      return totalNanoseconds
+               ? (static_cast<double>(runDurations.totalNanoseconds) / static_cast<double>(totalNanoseconds))
+               : 0;
+    }
+  };
+
   constexpr static decltype(std::thread::hardware_concurrency()) const MinimumGoferThreadsCount{ 1 };
   constexpr static decltype(std::thread::hardware_concurrency()) const MaximumGoferThreadsCount{ 1024 };
+  /// Unless there are no more CPUs in the CpuBudget than gofer threads, see #setMaximumSpinDuration.
+  constexpr static std::chrono::nanoseconds const DefaultMaximumSpinDuration{ std::chrono::microseconds(50) };
+
+private:
+  // Spinning lasts this many average errand durations, as waiting for errands or their completion rarely does.
+  constexpr static int64_t const SpinErrandDurationsFactor{ 2 };
+  // Weight of the previous average errand duration, versus 1 for the duration of the errand just run.
+  constexpr static int64_t const ErrandDurationsSmoothing{ 7 };
+  // Exponential backoff between checks while spinning, up to this many processor pauses.
+  constexpr static unsigned int const MaximumPausesCount{ 64 };
+
+  struct QueuedErrand
+  {
+    ErrandProcedure errand;
+    // Null if none.
+    ErrandsGroup* errandsGroupPointer;
+    // Only stamped if instrumented.
+    std::chrono::steady_clock::time_point enQueueTime;
+  };
+
+  // Written by its gofer thread only, and taken by the clients, so that uncontended relaxed atomics suffice.
+  struct alignas(CacheLineByteSize) GoferThreadCounters
+  {
+    struct Histogram
+    {
+      std::array<std::atomic<uint64_t>, DurationsHistogram::BucketsCount> counts{};
+      std::atomic<uint64_t> totalNanoseconds{ 0 };
+
+      void record(std::chrono::steady_clock::duration const duration) noexcept
+      {
+        auto const nanoseconds{ static_cast<uint64_t>(
+          std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), int64_t{ 0 })) };
+        counts[DurationsHistogram::bucketIndexOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+      }
+      DurationsHistogram take() noexcept
+      {
+        DurationsHistogram durationsHistogram;
+        for (std::size_t bucketIndex{ 0 }; bucketIndex != DurationsHistogram::BucketsCount; ++bucketIndex)
+          durationsHistogram.counts[bucketIndex] = counts[bucketIndex].exchange(0, std::memory_order_relaxed);
+        durationsHistogram.totalNanoseconds = totalNanoseconds.exchange(0, std::memory_order_relaxed);
+        return durationsHistogram;
+      }
+    };
+
+    Histogram queuedDurations, runDurations, idleDurations;
+    std::atomic<bool> retired{ false };
+  };
 
   // INSTANCE VARIABLES //
 private:
-  mutable std::mutex myMutex;           // 40 bytes. Protects the variables below.
-  unsigned int myErrandsLeftCount{ 0 }; // + 4 = 44 bytes. Being run AND still waiting in myErrandsQueue.
+  mutable std::mutex myMutex; // 40 bytes. Protects the variables below, atomics only being read without it.
+  // + 4 = 44 bytes. Being run AND still waiting in myErrandsQueue or myLowPriorityErrandsQueue.
+  std::atomic<unsigned int> myErrandsLeftCount{ 0 };
   /* Only used by the destructor to signal the gofer threads to die, as it is assumed that if GoferThreadsPool
      itself is shared, then it will NOT be destroyed by a sharer while other sharers are still using it.
   */
-  bool myMustDie{ false };                                              // + 4(1) = 48 byte.
-  std::queue<ErrandProcedure> myErrandsQueue;                           // + 80 = 128 = 2×64 bytes.
+  std::atomic<bool> myMustDie{ false };                                 // + 4(1) = 48 byte.
+  std::queue<QueuedErrand> myErrandsQueue;                              // + 80 = 128 = 2×64 bytes.
   mutable std::condition_variable_any myGoferThreadsConditionVariable;  // + 64 = 192 = 3×64 bytes.
   mutable std::condition_variable_any myClientThreadsConditionVariable; // + 64 = 256 = 4×64 bytes.
   std::vector<std::thread> myGoferThreadsVector;                        // + 24 = 280 = 4.375×64 bytes.
+  // Parked in the condition variables, so to be notified.
+  unsigned int myParkedGoferThreadsCount{ 0 };          // + 4 = 284 bytes.
+  mutable unsigned int myParkedClientThreadsCount{ 0 }; // + 4 = 288 = 4.5×64 bytes.
+  // Sizes of myErrandsQueue and myLowPriorityErrandsQueue, for the spinning gofer threads.
+  std::atomic<unsigned int> myQueuedErrandsCount{ 0 };        // + 8(4) = 296 bytes.
+  std::atomic<int64_t> myAverageErrandNanoseconds{ 0 };       // + 8 = 304 bytes.
+  std::atomic<int64_t> myMaximumSpinNanoseconds{ 0 };         // + 8 = 312 = 4.875×64 bytes.
+  // Only dequeued when myErrandsQueue is empty, so that background errands never delay the others.
+  std::queue<QueuedErrand> myLowPriorityErrandsQueue; // + 80 = 392 = 6.125×64 bytes.
+  // Joinable threads of myGoferThreadsVector, which only #setGoferThreadsCount modifies.
+  std::atomic<unsigned int> myGoferThreadsCount{ 0 };         // + 4 = 396 bytes.
+  // Gofer threads to retire on their next look for an errand, then listed in myRetiredGoferThreadIds to be joined.
+  std::atomic<unsigned int> myRetiringGoferThreadsCount{ 0 };  // + 4 = 400 bytes.
+  std::vector<std::thread::id> myRetiredGoferThreadIds;        // + 24 = 424 bytes.
+  // Serializes the #setGoferThreadsCount calls, so that only one modifies myGoferThreadsVector.
+  mutable std::mutex myResizingMutex;                          // + 40 = 464 = 7.25×64 bytes.
+  // One per gofer thread ever spawned, in order, as a deque never moves them. Appended under myResizingMutex.
+  std::deque<GoferThreadCounters> myGoferThreadsCounters;      // + 80 = 544 = 8.5×64 bytes.
+  std::atomic<bool> myIsInstrumented{ false };                 // + 8(1) = 552 bytes.
+  // Records each errand run, if not null, see #setTraceRecorder.
+  std::atomic<TraceRecorder*> myTraceRecorderPointer{ nullptr }; // + 8 = 560 = 8.75×64 bytes.
 
   // DESTRUCTOR //
 public:
@@ -539,25 +1160,24 @@ public:
 
   // CONSTRUCTORS //
 public:
-  /** @param[in] goferThreadsCount 0 for the number of cores ÷ 2.
+  /** @param[in] goferThreadsCount 0 for #defaultGoferThreadsCount.
       @post Throws an exception if a newly created thread is not joinable.
   */
   explicit GoferThreadsPool(decltype(std::thread::hardware_concurrency()) goferThreadsCount = 0)
   {
+    auto const cpusCount{ std::get<0>(CpuBudget()) };
     if (goferThreadsCount < 1)
-      // Real CPU core count is not guaranteed.
-      goferThreadsCount = std::thread::hardware_concurrency() / 2;
+      goferThreadsCount = defaultGoferThreadsCount();
 
     if (goferThreadsCount < MinimumGoferThreadsCount)
       goferThreadsCount = MinimumGoferThreadsCount;
     else if (goferThreadsCount > MaximumGoferThreadsCount)
       goferThreadsCount = MaximumGoferThreadsCount;
 
-    myGoferThreadsVector.reserve(goferThreadsCount);
-    while (goferThreadsCount--) {
-      if (not(myGoferThreadsVector.emplace_back([this]() { this->goferThreadMethod(); })).joinable())
-        throw std::runtime_error(String(+"Newly created thread is not joinable in: ", +__PRETTY_FUNCTION__, '.'));
-    }
+    // Spinning would steal time from the errands if the gofer threads already use all the CPU budget.
+    setMaximumSpinDuration((cpusCount > goferThreadsCount) ? DefaultMaximumSpinDuration : std::chrono::nanoseconds(0));
+
+    spawnGoferThreads(goferThreadsCount);
   }
 
   /// Deleted as gofer threads point to the instance variables.
@@ -572,88 +1192,233 @@ public:
   /// Deleted as gofer threads point to the instance variables.
   GoferThreadsPool& operator=(GoferThreadsPool&&) = delete;
 
+  // PUBLIC STATIC METHODS //
+public:
+  /** @return The CPU budget if restricted by a cgroup, see CpuBudget(), else the hardware threads ÷ 2 as they may
+      be hyper-threads sharing cores.
+  */
+  static decltype(std::thread::hardware_concurrency()) defaultGoferThreadsCount()
+  {
+    auto const [cpusCount, hardwareThreadsCount, cpusetCpusCount, quotaCpusCount]{ CpuBudget() };
+    return std::clamp((cpusCount < hardwareThreadsCount) ? cpusCount : (hardwareThreadsCount / 2),
+                      MinimumGoferThreadsCount,
+                      MaximumGoferThreadsCount);
+  }
+
+  // PRIVATE STATIC METHODS //
+private:
+  /// Hint the processor that this is a spin-wait loop, sparing the other hyper-thread and the memory bus.
+  static void pauseProcessor() noexcept
+  {
+#if defined(__x86_64__) or defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+  }
+
   // PRIVATE INSTANCE METHODS //
 private:
-  /* When a gofer thread is wakened up from myGoferThreadsConditionVariable, thus inside the lock guard context,
-     it finds itself in one of four conditions:
+  /** Spin for up to #spinDuration, pausing exponentially longer between checks.
+      @return True if ready() returned true, else false, as when #spinDuration is 0.
+  */
+  template<typename Ready>
+  bool spinUntil(Ready const& ready) const
+  {
+    auto const spinDuration{ this->spinDuration() };
+    if (not spinDuration.count())
+      return false;
+
+    auto const deadline{ std::chrono::steady_clock::now() + spinDuration };
+    for (unsigned int pausesCount{ 1 }; not ready(); pausesCount = std::min(pausesCount * 2, MaximumPausesCount)) {
+      if (std::chrono::steady_clock::now() >= deadline)
+        return false;
+      for (auto pausesLeftCount{ pausesCount }; pausesLeftCount; --pausesLeftCount)
+        pauseProcessor();
+    }
+    return true;
+  }
+
+  /// @return Now if instrumented, else the clock's epoch, so as to not read the clock needlessly.
+  std::chrono::steady_clock::time_point enQueueTimeIfInstrumented() const noexcept
+  {
+    return myIsInstrumented.load(std::memory_order_relaxed) ? std::chrono::steady_clock::now()
+                                                            : std::chrono::steady_clock::time_point();
+  }
+
+  /// @pre Inside the lock context.
+  unsigned int queuedErrandsCount() const noexcept
+  {
+    return static_cast<unsigned int>(myErrandsQueue.size() + myLowPriorityErrandsQueue.size());
+  }
+  /// @pre Inside the lock context.
+  std::queue<QueuedErrand>& errandsQueue(ErrandsPriority const errandsPriority) noexcept
+  {
+    return (errandsPriority == ErrandsPriority::Low) ? myLowPriorityErrandsQueue : myErrandsQueue;
+  }
+
+  /// Spawn more gofer threads, up to goferThreadsCount in all. @post Throws if a new thread is not joinable.
+  void spawnGoferThreads(unsigned int const goferThreadsCount)
+  {
+    myGoferThreadsVector.reserve(goferThreadsCount);
+    while (myGoferThreadsVector.size() < goferThreadsCount) {
+      auto& goferThreadCounters{ myGoferThreadsCounters.emplace_back() };
+      auto const& goferThread{ myGoferThreadsVector.emplace_back(
+        [this, &goferThreadCounters]() { this->goferThreadMethod(goferThreadCounters); }) };
+      if (not goferThread.joinable())
+        throw std::runtime_error(String(+"Newly created thread is not joinable in: ", +__PRETTY_FUNCTION__, '.'));
+      ++myGoferThreadsCount;
+    }
+  }
+
+  /* Inside the lock context, a gofer thread finds itself in one of four conditions:
      1. myMustDie is true, thus return right away;
-     2. myErrandsLeftCount is 0 so just notify all in myClientThreadsConditionVariable
-        and then go wait back in myGoferThreadsConditionVariable;
-     3. myErrandsLeftCount is not 0 but myErrandsQueue is empty,
-        just go back in myGoferThreadsConditionVariable;
-     4. myErrandsLeftCount is not 0 and therefore myErrandsQueue is not empty,
-        pop an errand and run it outside the lock guard context,
-        and then get back in the lock guard context and repeat as if just out of myGoferThreadsConditionVariable.
+     2. myRetiringGoferThreadsCount is not 0, so list itself as retired, signal the parked client threads, and return;
+     3. myErrandsQueue, or else myLowPriorityErrandsQueue, is not empty, so pop an errand and run it outside the lock
+        context, then get back in the lock context, signal the parked client threads if no errand is left, in the
+        pool or in the errand's group, and repeat. The errand's group's completion procedure first runs outside the
+        lock context if this was the group's last errand left;
+     4. Both queues are empty, so spin outside the lock context until an errand is queued or a retirement requested,
+        or else go park in myGoferThreadsConditionVariable, and repeat.
   */
-  void goferThreadMethod()
+  void goferThreadMethod(GoferThreadCounters& goferThreadCounters)
   {
-    std::decay_t<decltype(myErrandsQueue.front())> errand;
-    bool firstTime{ true };
+    ErrandProcedure errand;
+    ErrandsGroup* errandsGroupPointer;
+    std::chrono::steady_clock::time_point enQueueTime;
+    // Unknown unless the previous errand was timed.
+    std::chrono::steady_clock::time_point idleStartTime;
+    if (myIsInstrumented.load(std::memory_order_relaxed))
+      idleStartTime = std::chrono::steady_clock::now();
+    std::unique_lock lock(myMutex);
     // Loop forever, or return if myMustDie.
     // ## Run-errands loop ##
     for (;;) {
-      // ## Lock guard context ##
-      {
-        std::lock_guard const lockGuard(myMutex);
-
-        if (firstTime)
-          firstTime = false;
-        else
-          // One errand was just ran by me below.
-          --myErrandsLeftCount;
-
-        // Loop forever, or return if myMustDie, run an errand.
-        // ## Look-for-an-errand-to-run loop ##
-        for (;;) {
-          if (myMustDie)
-            return;
-
-          // If there are errands left.
-          if (myErrandsLeftCount) {
-            // Some may still be in the queue, not being run.
-            if (not myErrandsQueue.empty()) {
-              // Get one errand (errands queue's front moved from as destroyed right after in pop()).
-              errand = std::move(myErrandsQueue.front());
-              myErrandsQueue.pop();
-              // AND go run it OUT of the lock guard context.
-              break;
-            }
-            // There is no errand left in the queue, so go wait in the gofer threads condition variable below.
-          } else {
-            // There is no errand left so signal and then go wait in the gofer threads condition variable below.
+      // Loop forever, or return if myMustDie, run an errand.
+      // ## Look-for-an-errand-to-run loop ##
+      for (;;) {
+        if (myMustDie)
+          return;
+
+        if (myRetiringGoferThreadsCount) {
+          --myRetiringGoferThreadsCount;
+          myRetiredGoferThreadIds.push_back(std::this_thread::get_id());
+          goferThreadCounters.retired = true;
+          if (myParkedClientThreadsCount)
             myClientThreadsConditionVariable.notify_all();
-          }
+          return;
+        }
 
-          myGoferThreadsConditionVariable.wait(myMutex);
-        } // ## End of look-for-an-errand-to-run loop ##
+        if (queuedErrandsCount()) {
+          auto& errandsQueue{ myErrandsQueue.empty() ? myLowPriorityErrandsQueue : myErrandsQueue };
+          // Get one errand (errands queue's front moved from as destroyed right after in pop()).
+          errand = std::move(errandsQueue.front().errand);
+          errandsGroupPointer = errandsQueue.front().errandsGroupPointer;
+          enQueueTime = errandsQueue.front().enQueueTime;
+          errandsQueue.pop();
+          myQueuedErrandsCount.store(queuedErrandsCount(), std::memory_order_relaxed);
+          // AND go run it OUT of the lock context.
+          break;
+        }
+
+        // Spin OUT of the lock context, then look again if an errand was queued, else park.
+        lock.unlock();
+        bool const errandQueued{ spinUntil([this]() {
+          return myQueuedErrandsCount.load(std::memory_order_relaxed) or myMustDie.load(std::memory_order_relaxed) or
+                 myRetiringGoferThreadsCount.load(std::memory_order_relaxed);
+        }) };
+        lock.lock();
+        if (not errandQueued) {
+          ++myParkedGoferThreadsCount;
+          myGoferThreadsConditionVariable.wait(
+            lock, [this]() { return myMustDie or myRetiringGoferThreadsCount or queuedErrandsCount(); });
+          --myParkedGoferThreadsCount;
+        }
+      } // ## End of look-for-an-errand-to-run loop ##
 
-        // 'break;' above breaks here.
+      // 'break;' above breaks here.
+      lock.unlock();
 
-      } // ## End of lock guard context ##
+      /* Run the errand OUT of the lock context, timing it if needed to tune the spin duration, or if instrumented or
+         traced.
+      */
+      auto const traceRecorderPointer{ myTraceRecorderPointer.load(std::memory_order_relaxed) };
+      if (bool const isInstrumented{ myIsInstrumented.load(std::memory_order_relaxed) };
+          isInstrumented or traceRecorderPointer or myMaximumSpinNanoseconds.load(std::memory_order_relaxed)) {
+        auto const startTime{ std::chrono::steady_clock::now() };
+        if (isInstrumented) {
+          if (enQueueTime.time_since_epoch().count())
+            goferThreadCounters.queuedDurations.record(startTime - enQueueTime);
+          if (idleStartTime.time_since_epoch().count())
+            goferThreadCounters.idleDurations.record(startTime - idleStartTime);
+        }
+        errand();
+        idleStartTime = std::chrono::steady_clock::now();
+        if (isInstrumented)
+          goferThreadCounters.runDurations.record(idleStartTime - startTime);
+        if (traceRecorderPointer)
+          traceRecorderPointer->record("Errand", startTime, idleStartTime);
+        auto const errandNanoseconds{
+          std::chrono::duration_cast<std::chrono::nanoseconds>(idleStartTime - startTime).count()
+        };
+        // Racing gofer threads may lose an update, which is fine for an average.
+        auto const averageErrandNanoseconds{ myAverageErrandNanoseconds.load(std::memory_order_relaxed) };
+        myAverageErrandNanoseconds.store(
+          ((averageErrandNanoseconds * ErrandDurationsSmoothing) + errandNanoseconds) / (ErrandDurationsSmoothing + 1),
+          std::memory_order_relaxed);
+      } else {
+        errand();
+        idleStartTime = {};
+      }
 
-      // Run the errand OUT of the lock guard context.
-      errand();
+      lock.lock();
+      // The errand just ran by me above. Complete its group BEFORE the pool's count, as a client waiting for all the
+      // errands may destroy the group as soon as that count drops to 0.
+      bool errandsCompleted{ false };
+      if (errandsGroupPointer) {
+        if ((errandsGroupPointer->myErrandsLeftCount == 1) and errandsGroupPointer->myCompletionProcedure) {
+          lock.unlock();
+          errandsGroupPointer->myCompletionProcedure();
+          lock.lock();
+        }
+        // Do not touch the group after this, as its client may destroy it.
+        errandsCompleted = not --errandsGroupPointer->myErrandsLeftCount;
+      }
+      errandsCompleted = (not --myErrandsLeftCount) or errandsCompleted;
+      if (errandsCompleted and myParkedClientThreadsCount)
+        myClientThreadsConditionVariable.notify_all();
     } // ## End of run-errands loop ##
   }
 
   // Only get errands of type ErrandProcedure.
   template<typename Errand>
-  bool privateEnQueueErrand(Errand&& errand)
+  bool privateEnQueueErrand(Errand&& errand,
+                            ErrandsGroup* const errandsGroupPointer,
+                            ErrandsPriority const errandsPriority)
   {
     if (errand) {
+      bool goferThreadsAreParked;
       // Lock guard context.
       {
         std::lock_guard const lockGuard(myMutex);
         // errand is queued-in.
-        myErrandsQueue.push(std::forward<Errand>(errand));
+        errandsQueue(errandsPriority)
+          .push({ std::forward<Errand>(errand), errandsGroupPointer, enQueueTimeIfInstrumented() });
+        myQueuedErrandsCount.store(queuedErrandsCount(), std::memory_order_relaxed);
         ++myErrandsLeftCount;
+        if (errandsGroupPointer)
+          ++errandsGroupPointer->myErrandsLeftCount;
+        goferThreadsAreParked = myParkedGoferThreadsCount;
       }
 
-      /* Notify the gofer threads condition variable. (In C++17 Standard N4660, ¶33.5-2: "Condition variables
-         permit concurrent invocation of the [...] notify_one and notify_all member functions.")
-         ALL myGoferThreadsConditionVariable.wait() calls are done via the same mutex.
+      /* Notify the gofer threads condition variable, if a gofer thread is parked in it. (In C++17 Standard N4660,
+         ¶33.5-2: "Condition variables permit concurrent invocation of the [...] notify_one and notify_all member
+         functions.") ALL myGoferThreadsConditionVariable.wait() calls are done via the same mutex.
       */
-      myGoferThreadsConditionVariable.notify_one();
+      if (goferThreadsAreParked)
+        myGoferThreadsConditionVariable.notify_one();
 
       return true;
     }
@@ -661,52 +1426,24 @@ private:
     return false;
   }
 
-  // PUBLIC INSTANCE METHODS //
-public:
-  decltype(auto) goferThreadsCount() const noexcept(noexcept(myGoferThreadsVector[0].joinable()))
-  {
-    unsigned int count{ 0 };
-    // Assume std::thread::joinable() is itself thread-safe, as it is const.
-    for (auto const& goferThread : myGoferThreadsVector)
-      if (goferThread.joinable())
-        ++count;
-
-    return count;
-  }
-
-  /** @param[in] errand to be eventually run by the gofer threads,
-      of type void() e.g. +[] { ... } or [=, &a]() { a += b; }.
-      @pre Errands MUST be thread-safe OR share NO data.
-      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
-  */
-  bool enQueueErrand(ErrandProcedure&& errand) { return privateEnQueueErrand(std::move(errand)); }
-  /** @param[in] errand to be eventually run by the gofer threads,
-      of type void() e.g. [=, &a]() { a += b; }.
-      @pre Errands MUST be thread-safe OR share NO data.
-      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
-  */
-  bool enQueueErrand(ErrandProcedure const& errand) { return privateEnQueueErrand(errand); }
-
-  /** @param[in] errandsContainer Container of thread-safe errands to be eventually run by the gofer threads.
-      It must support range-based for loops. Each errand must be of type void() e.g. [=, &a]() { a += b; }.
-      Marked 'const' although its elements may be moved from according to next argument.
-      @param[in] preserveErrands FALSE if ALL the errands from the container can be moved from.
-      @pre Errands MUST be thread-safe OR share NO data.
-      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
-  */
   template<typename Container>
-  decltype(auto) enQueueErrands(Container const& errandsContainer, bool const preserveErrands = true)
+  decltype(auto) privateEnQueueErrands(Container const& errandsContainer,
+                                       bool const preserveErrands,
+                                       ErrandsGroup* const errandsGroupPointer,
+                                       ErrandsPriority const errandsPriority)
   {
     // All the errands that must be of type std::function<void()>
-    static_assert(
-      std::is_same_v<std::decay_t<decltype(myErrandsQueue.front())>, std::decay_t<decltype(errandsContainer[0])>>,
-      "errandsContainer must contain errands of type std::function<void()>.");
+    static_assert(std::is_same_v<ErrandProcedure, std::decay_t<decltype(errandsContainer[0])>>,
+                  "errandsContainer must contain errands of type std::function<void()>.");
 
-    decltype(myErrandsLeftCount) errandsEnqueuedCount{ 0 };
+    unsigned int errandsEnqueuedCount{ 0 };
     if (not errandsContainer.empty()) {
+      bool goferThreadsAreParked;
       // Lock guard context.
       {
         std::lock_guard const lockGuard(myMutex);
+        auto& errandsQueue{ this->errandsQueue(errandsPriority) };
+        auto const enQueueTime{ enQueueTimeIfInstrumented() };
 
         // Copy-queue-in all the errands.
         if (preserveErrands) {
@@ -714,7 +1451,7 @@ public:
           for (auto const& errand : errandsContainer)
             if (errand) {
               // errand is copied-queued-in.
-              myErrandsQueue.push(errand);
+              errandsQueue.push({ errand, errandsGroupPointer, enQueueTime });
               ++errandsEnqueuedCount;
             }
         } else {
@@ -722,41 +1459,305 @@ public:
           for (auto&& errand : errandsContainer)
             if (errand) {
               // errand is moved-from-queued-in.
-              myErrandsQueue.push(std::move(errand));
+              errandsQueue.push({ std::move(errand), errandsGroupPointer, enQueueTime });
               ++errandsEnqueuedCount;
             }
         }
 
+        myQueuedErrandsCount.store(queuedErrandsCount(), std::memory_order_relaxed);
         myErrandsLeftCount += errandsEnqueuedCount;
+        if (errandsGroupPointer)
+          errandsGroupPointer->myErrandsLeftCount += errandsEnqueuedCount;
+        goferThreadsAreParked = myParkedGoferThreadsCount;
       }
       // End of lock guard context
 
-      /* Notify the gofer threads condition variable. (In C++17 Standard N4660, ¶33.5-2: "Condition variables
-         permit concurrent invocation of the [...] notify_one and notify_all member functions.")
-         ALL condition variables wait() calls are done via the same myMutex.
+      /* Notify the gofer threads condition variable, if a gofer thread is parked in it. (In C++17 Standard N4660,
+         ¶33.5-2: "Condition variables permit concurrent invocation of the [...] notify_one and notify_all member
+         functions.") ALL condition variables wait() calls are done via the same myMutex.
       */
-      if (errandsEnqueuedCount > 1)
-        myGoferThreadsConditionVariable.notify_all();
-      else if (errandsEnqueuedCount)
-        myGoferThreadsConditionVariable.notify_one();
+      if (goferThreadsAreParked) {
+        if (errandsEnqueuedCount > 1)
+          myGoferThreadsConditionVariable.notify_all();
+        else if (errandsEnqueuedCount)
+          myGoferThreadsConditionVariable.notify_one();
+      }
     }
 
     return errandsEnqueuedCount;
   }
 
-  decltype(auto) errandsLeftCount() const
-  // Lock guard context.
+  /** @return Errand running the errand errandIndex of errandsGraph, then enqueuing those of its successors whose
+      predecessors all completed. They are enqueued before it counts as completed, so that the graph's errands left
+      count only reaches 0 once all its errands completed.
+  */
+  ErrandProcedure errandsGraphErrand(ErrandsGraph& errandsGraph,
+                                     ErrandsGraph::ErrandIndex const errandIndex,
+                                     ErrandsPriority const errandsPriority)
+  {
+    return [this, &errandsGraph, errandIndex, errandsPriority]() {
+      auto& node{ errandsGraph.myNodes[errandIndex] };
+      if (node.errand)
+        node.errand();
+      for (auto const successorIndex : node.successorIndexes)
+        if (not --errandsGraph.myNodes[successorIndex].predecessorsLeftCount)
+          privateEnQueueErrand(errandsGraphErrand(errandsGraph, successorIndex, errandsPriority),
+                               std::addressof(errandsGraph.myErrandsGroup),
+                               errandsPriority);
+    };
+  }
+
+  /// Spin for up to #spinDuration, then park until completed() returns true.
+  template<typename Completed>
+  void waitUntilCompleted(Completed const& completed) const
   {
+    if (spinUntil(completed))
+      return;
+
+    // Lock guard context.
     std::lock_guard const lockGuard(myMutex);
-    return myErrandsLeftCount;
+    ++myParkedClientThreadsCount;
+    myClientThreadsConditionVariable.wait(myMutex, completed);
+    --myParkedClientThreadsCount;
+  }
+
+  // PUBLIC INSTANCE METHODS //
+public:
+  decltype(auto) goferThreadsCount() const noexcept { return myGoferThreadsCount.load(); }
+
+  /** Keep, or not, per gofer thread histograms of how long errands were queued and ran, and of the idle time between
+      them, at the cost of reading the clock around each errand and of a few uncontended atomic increments.
+  */
+  void setInstrumented(bool const isInstrumented) noexcept
+  {
+    myIsInstrumented.store(isInstrumented, std::memory_order_relaxed);
+  }
+  bool isInstrumented() const noexcept { return myIsInstrumented.load(std::memory_order_relaxed); }
+  /** Record each errand run into traceRecorderPointer, as a span named "Errand", or stop recording if null.
+      @pre The recorder outlives the pool, or recording is stopped first while no errand is left.
+  */
+  void setTraceRecorder(TraceRecorder* const traceRecorderPointer) noexcept
+  {
+    myTraceRecorderPointer.store(traceRecorderPointer, std::memory_order_relaxed);
+  }
+  /// @return The statistics of each gofer thread ever spawned, in order, since last taken, then reset them.
+  std::vector<GoferThreadStatistics> takeGoferThreadsStatistics()
+  {
+    std::vector<GoferThreadStatistics> goferThreadsStatistics;
+    std::lock_guard const resizingLockGuard(myResizingMutex);
+    for (auto&& goferThreadCounters : myGoferThreadsCounters)
+      goferThreadsStatistics.push_back({ goferThreadCounters.queuedDurations.take(),
+                                         goferThreadCounters.runDurations.take(),
+                                         goferThreadCounters.idleDurations.take(),
+                                         goferThreadCounters.retired.load() });
+    return goferThreadsStatistics;
+  }
+
+  /** Grow or shrink the pool at runtime, e.g. as the machine gets busier or frees up. Shrinking waits for enough
+      gofer threads to be done with their current errand, the queued errands being left to the others.
+      @param[in] goferThreadsCount 0 for #defaultGoferThreadsCount.
+      @pre NOT called from an errand, as its gofer thread could wait for itself to retire.
+      @post Throws an exception if a newly created thread is not joinable.
+  */
+  void setGoferThreadsCount(decltype(std::thread::hardware_concurrency()) goferThreadsCount)
+  {
+    if (goferThreadsCount < 1)
+      goferThreadsCount = defaultGoferThreadsCount();
+    goferThreadsCount = std::clamp(goferThreadsCount, MinimumGoferThreadsCount, MaximumGoferThreadsCount);
+
+    std::lock_guard const resizingLockGuard(myResizingMutex);
+    if (goferThreadsCount >= myGoferThreadsVector.size()) {
+      spawnGoferThreads(goferThreadsCount);
+      return;
+    }
+
+    // Request the retirements, then wait for them.
+    auto const retiringGoferThreadsCount{ static_cast<unsigned int>(myGoferThreadsVector.size() - goferThreadsCount) };
+    decltype(myRetiredGoferThreadIds) retiredGoferThreadIds;
+    // Lock context.
+    {
+      std::unique_lock lock(myMutex);
+      myRetiringGoferThreadsCount = retiringGoferThreadsCount;
+      if (myParkedGoferThreadsCount)
+        myGoferThreadsConditionVariable.notify_all();
+      ++myParkedClientThreadsCount;
+      myClientThreadsConditionVariable.wait(lock, [this, retiringGoferThreadsCount]() {
+        return myRetiredGoferThreadIds.size() == retiringGoferThreadsCount;
+      });
+      --myParkedClientThreadsCount;
+      retiredGoferThreadIds.swap(myRetiredGoferThreadIds);
+    }
+
+    // Join the retired gofer threads, which returned.
+    for (auto const retiredGoferThreadId : retiredGoferThreadIds) {
+      auto const goferThreadIterator{ std::find_if(
+        myGoferThreadsVector.begin(), myGoferThreadsVector.end(), [retiredGoferThreadId](auto const& goferThread) {
+          return goferThread.get_id() == retiredGoferThreadId;
+        }) };
+      goferThreadIterator->join();
+      myGoferThreadsVector.erase(goferThreadIterator);
+      --myGoferThreadsCount;
+    }
+  }
+
+  /** @param[in] errand to be eventually run by the gofer threads,
+      of type void() e.g. +[] { ... } or [=, &a]() { a += b; }.
+      @pre Errands MUST be thread-safe OR share NO data.
+      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
+  */
+  bool enQueueErrand(ErrandProcedure&& errand, ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrand(std::move(errand), nullptr, errandsPriority);
+  }
+  /** @param[in] errand to be eventually run by the gofer threads,
+      of type void() e.g. [=, &a]() { a += b; }.
+      @pre Errands MUST be thread-safe OR share NO data.
+      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
+  */
+  bool enQueueErrand(ErrandProcedure const& errand, ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrand(errand, nullptr, errandsPriority);
+  }
+  /// Enqueue errand in errandsGroup, see #ErrandsGroup.
+  bool enQueueErrand(ErrandProcedure&& errand,
+                     ErrandsGroup& errandsGroup,
+                     ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrand(std::move(errand), std::addressof(errandsGroup), errandsPriority);
+  }
+  /// Enqueue errand in errandsGroup, see #ErrandsGroup.
+  bool enQueueErrand(ErrandProcedure const& errand,
+                     ErrandsGroup& errandsGroup,
+                     ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrand(errand, std::addressof(errandsGroup), errandsPriority);
+  }
+
+  /** @param[in] procedure Thread-safe procedure taking no argument, to be eventually run by the gofer threads.
+      @return Future for its result, or for the exception it threw.
+      @post Waiting for the future from an errand WILL deadlock if all the gofer threads end up doing so.
+  */
+  template<typename Procedure>
+  auto submit(Procedure&& procedure, ErrandsPriority const errandsPriority = ErrandsPriority::High)
+    -> std::future<std::invoke_result_t<std::decay_t<Procedure>>>
+  {
+    // std::packaged_task is not copyable as required by ErrandProcedure, so share it.
+    auto const taskPointer{ std::make_shared<std::packaged_task<std::invoke_result_t<std::decay_t<Procedure>>()>>(
+      std::forward<Procedure>(procedure)) };
+    auto future{ taskPointer->get_future() };
+    privateEnQueueErrand(ErrandProcedure([taskPointer]() { (*taskPointer)(); }), nullptr, errandsPriority);
+
+    return future;
   }
 
-  /// @post This WILL deadlock if an errand deadlocks or does not end.
+#ifdef __cpp_lib_coroutine
+  /** co_await schedule() resumes the awaiting coroutine as an errand, i.e. on a gofer thread, see #Task.
+      @post Awaiting coroutines must NOT wait for all errands to complete, as their own errand is one of them.
+  */
+  ScheduleAwaiter schedule(ErrandsPriority const errandsPriority = ErrandsPriority::High) noexcept
+  {
+    return ScheduleAwaiter(*this, errandsPriority);
+  }
+  /** co_await whenAll(errandsContainer) enqueues its errands, then resumes the awaiting coroutine on the gofer thread
+      completing the last one, without any thread blocking in the meantime, see #Task.
+      @pre errandsContainer, of std::function<void()>, outlives the co_await.
+  */
+  template<typename Container>
+  WhenAllAwaiter<Container> whenAll(Container const& errandsContainer,
+                                    ErrandsPriority const errandsPriority = ErrandsPriority::High) noexcept
+  {
+    return WhenAllAwaiter<Container>(*this, errandsContainer, errandsPriority);
+  }
+
+#endif
+  /** Enqueue the errands of errandsGraph without predecessors, each other one being enqueued once its predecessors
+      all completed, see #ErrandsGraph. Wait for them with waitForAllErrandsToComplete(errandsGraph).
+      @return Number of errands enqueued right away.
+  */
+  decltype(auto) enQueueErrandsGraph(ErrandsGraph& errandsGraph,
+                                     ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    if (errandsGraph.myErrandsGroup.errandsLeftCount())
+      throw std::logic_error(String(+"ErrandsGraph enqueued while running in: ", +__PRETTY_FUNCTION__, '.'));
+
+    std::vector<ErrandProcedure> rootErrands;
+    for (ErrandsGraph::ErrandIndex errandIndex{ 0 }; errandIndex != errandsGraph.myNodes.size(); ++errandIndex) {
+      auto& node{ errandsGraph.myNodes[errandIndex] };
+      node.predecessorsLeftCount = node.predecessorsCount;
+      if (not node.predecessorsCount)
+        rootErrands.push_back(errandsGraphErrand(errandsGraph, errandIndex, errandsPriority));
+    }
+    // At once, so that the graph does not look completed before all its roots were enqueued.
+    return privateEnQueueErrands(rootErrands, false, std::addressof(errandsGraph.myErrandsGroup), errandsPriority);
+  }
+
+  /** @param[in] errandsContainer Container of thread-safe errands to be eventually run by the gofer threads.
+      It must support range-based for loops. Each errand must be of type void() e.g. [=, &a]() { a += b; }.
+      Marked 'const' although its elements may be moved from according to next argument.
+      @param[in] preserveErrands FALSE if ALL the errands from the container can be moved from.
+      @param[in] errandsPriority Low to only run them when no high priority errand is queued.
+      @pre Errands MUST be thread-safe OR share NO data.
+      Each errand must capture by reference ONLY values that are guaranteed to outlive it.
+  */
+  template<typename Container>
+  decltype(auto) enQueueErrands(Container const& errandsContainer,
+                                bool const preserveErrands = true,
+                                ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrands(errandsContainer, preserveErrands, nullptr, errandsPriority);
+  }
+  /// Enqueue the errands of errandsContainer in errandsGroup, see #ErrandsGroup.
+  template<typename Container>
+  decltype(auto) enQueueErrands(Container const& errandsContainer,
+                                ErrandsGroup& errandsGroup,
+                                bool const preserveErrands = true,
+                                ErrandsPriority const errandsPriority = ErrandsPriority::High)
+  {
+    return privateEnQueueErrands(errandsContainer, preserveErrands, std::addressof(errandsGroup), errandsPriority);
+  }
+
+  decltype(auto) errandsLeftCount() const noexcept { return myErrandsLeftCount.load(); }
+
+  /** Spin for up to maximumSpinDuration, pausing exponentially longer, before parking to wait for errands or for
+      their completion, as waking up parked threads costs microseconds. 0 parks right away.
+  */
+  void setMaximumSpinDuration(std::chrono::nanoseconds const maximumSpinDuration) noexcept
+  {
+    myMaximumSpinNanoseconds.store(std::max(maximumSpinDuration.count(), decltype(maximumSpinDuration.count()){ 0 }),
+                                   std::memory_order_relaxed);
+  }
+  std::chrono::nanoseconds maximumSpinDuration() const noexcept
+  {
+    return std::chrono::nanoseconds(myMaximumSpinNanoseconds.load(std::memory_order_relaxed));
+  }
+  /// @return How long to spin before parking: a few average errand durations, up to #maximumSpinDuration.
+  std::chrono::nanoseconds spinDuration() const noexcept
+  {
+    return std::chrono::nanoseconds(
+      std::min(myAverageErrandNanoseconds.load(std::memory_order_relaxed) * SpinErrandDurationsFactor,
+               myMaximumSpinNanoseconds.load(std::memory_order_relaxed)));
+  }
+
+  /** Also waits for the low priority errands: wait for an ErrandsGroup instead if sharing the pool with them.
+      @post This WILL deadlock if an errand deadlocks or does not end.
+  */
   void waitForAllErrandsToComplete() const
-  // Lock guard context.
   {
-    std::lock_guard const lockGuard(myMutex);
-    myClientThreadsConditionVariable.wait(myMutex, [this]() { return not myErrandsLeftCount; });
+    waitUntilCompleted([this]() { return not myErrandsLeftCount; });
+  }
+  /** Wait for the errands of errandsGroup only, and its completion procedure.
+      @post This WILL deadlock if one of them deadlocks or does not end.
+  */
+  void waitForAllErrandsToComplete(ErrandsGroup const& errandsGroup) const
+  {
+    waitUntilCompleted([&errandsGroup]() { return not errandsGroup.myErrandsLeftCount; });
+  }
+  /** Wait for all the errands of errandsGraph, and its completion procedure.
+      @post This WILL deadlock if one of them deadlocks or does not end.
+  */
+  void waitForAllErrandsToComplete(ErrandsGraph const& errandsGraph) const
+  {
+    waitForAllErrandsToComplete(errandsGraph.myErrandsGroup);
   }
   /** @param[in] timePeriod A time period of type std::chrono::time_point<Clock, Duration>.
       @return True if all errands completed within timePeriod, else false.
@@ -766,7 +1767,11 @@ public:
   // Lock guard context.
   {
     std::lock_guard const lockGuard(myMutex);
-    return myClientThreadsConditionVariable.wait_for(myMutex, timePeriod, [this]() { return not myErrandsLeftCount; });
+    ++myParkedClientThreadsCount;
+    auto const allErrandsCompleted{ myClientThreadsConditionVariable.wait_for(
+      myMutex, timePeriod, [this]() { return not myErrandsLeftCount; }) };
+    --myParkedClientThreadsCount;
+    return allErrandsCompleted;
   }
   /** @param[in] time Absolute time of type std::chrono::time_point<Clock, Duration>.
       @return True if all errands completed within time, else false.
@@ -776,7 +1781,11 @@ public:
   // Lock guard context.
   {
     std::lock_guard const lockGuard(myMutex);
-    return myClientThreadsConditionVariable.wait_until(myMutex, time, [this]() { return not myErrandsLeftCount; });
+    ++myParkedClientThreadsCount;
+    auto const allErrandsCompleted{ myClientThreadsConditionVariable.wait_until(
+      myMutex, time, [this]() { return not myErrandsLeftCount; }) };
+    --myParkedClientThreadsCount;
+    return allErrandsCompleted;
   }
 };
 
@@ -929,7 +1938,7 @@ class NoConstructAllocator : public BaseAllocator
 protected:
   // Rebind allocators are set to BaseAllocator's own rebinds.
   template<typename Rebind>
-  using rebind = typename BaseAllocator::template rebind<Rebind>;
+  using rebind = typename std::allocator_traits<BaseAllocator>::template rebind_alloc<Rebind>;
 
   // PUBLIC INSTANCE METHODS //
 public:
@@ -1019,6 +2028,79 @@ public:
 ***********
 */
 
+/** Fenwick (binary indexed) tree of non-negative values, to sample indexes proportionally to their values.
+    Adding to a value, summing a prefix and finding the index of a cumulated value are all O(log size).
+*/
+template<typename Value>
+class FenwickTree
+{
+  // INSTANCE VARIABLES //
+private:
+  // One-based: node i sums the values of indexes (i - lowest set bit of i, i].
+  std::vector<Value> myNodes;
+
+  // CONSTRUCTORS //
+public:
+  /// All values are 0.
+  explicit FenwickTree(size_t const size)
+    : myNodes(size + 1, 0)
+  {
+  }
+
+  // PUBLIC INSTANCE METHODS //
+public:
+  decltype(auto) size() const noexcept { return myNodes.size() - 1; }
+
+  /// Add delta to the value at index.
+  void add(size_t index, Value const delta) noexcept
+  {
+    for (++index; index < myNodes.size(); index += (index & (~index + 1)))
+      myNodes[index] += delta;
+  }
+
+  /// @return The sum of the values at indexes [0, endIndex).
+  Value prefixSum(size_t endIndex) const noexcept
+  {
+    Value sum{ 0 };
+    for (; endIndex; endIndex -= (endIndex & (~endIndex + 1)))
+      sum += myNodes[endIndex];
+    return sum;
+  }
+  Value total() const noexcept { return prefixSum(size()); }
+  Value operator[](size_t const index) const noexcept { return prefixSum(index + 1) - prefixSum(index); }
+
+  /** @return The smallest index whose prefix sum, its value included, exceeds cumulatedValue,
+      or #size if cumulatedValue >= #total.
+  */
+  size_t find(Value cumulatedValue) const noexcept
+  {
+    size_t index{ 0 };
+    size_t step{ 1 };
+    while ((step << 1) < myNodes.size())
+      step <<= 1;
+
+    for (; step; step >>= 1)
+      if (((index + step) < myNodes.size()) and (myNodes[index + step] <= cumulatedValue)) {
+        index += step;
+        cumulatedValue -= myNodes[index];
+      }
+    return index;
+  }
+
+  /// Multiply all values by factor, in O(size) as each node is a sum of values.
+  void scale(Value const factor) noexcept
+  {
+    for (auto&& node : myNodes)
+      node *= factor;
+  }
+};
+
+/*
+***********
+** CLASS **
+***********
+*/
+
 class Timer
 {
   // DEFINITIONS //
@@ -2,6 +2,7 @@
 ## Compile Flags ##
 ###################
 
+# 'c++20' also compiles the coroutine awaitables of GoferThreadsPool.
 CPP_STANDARD='c++17'
 
 COMPILE_FLAGS="-std=$CPP_STANDARD -pedantic-errors -fdiagnostics-color=always -pipe"
@@ -0,0 +1,273 @@
+// testGoferThreadsPoolSpeeds.cpp
+
+/** @file
+    Benchmark the scheduling overheads of GoferThreadsPool that every training cycle pays: the round-trip latency of
+    an empty errand, the empty errands per second enqueued by contending client threads, and the cost of a barrier of
+    one empty errand per gofer thread, for 1 up to a maximum number of gofer threads. Each scheduling mode is measured
+    alike, so that a new one can be compared against the current mutex and queue design, and the results are also
+    written as JSON for tracking them across changes.
+
+    Usage: testGoferThreadsPoolSpeeds [<maximum gofer threads count> [<repetitions count> [<JSON file name>]]]
+
+    @author Nicolas Chaussé
+
+    @copyright Copyright 2022 Nicolas Chaussé (nicolaschausse@protonmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3 of the License only.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    @date 2022
+*/
+
+/*
+**************
+** INCLUDES **
+**************
+*/
+
+#include <numeric>
+
+#include "Utilities.hpp"
+
+/*
+*****************
+** DEFINITIONS **
+*****************
+*/
+
+using GoferThreadsCount = decltype(std::thread::hardware_concurrency());
+
+// Client threads enqueuing empty errands one at a time while measuring the errands per second.
+constexpr static unsigned int const ContendingClientsCount{ 4 };
+
+/// How the gofer threads are woken up and the errands enqueued and waited for. Add new scheduling modes to main().
+struct SchedulingMode
+{
+  std::string name;
+  // Applied to each new pool, if callable, else the pool keeps its constructor's settings.
+  std::function<void(GoferThreadsPool&)> configure;
+  // Each client enqueues in and waits for its own errands group, as clients sharing a pool do.
+  bool errandsAreGrouped{ false };
+  GoferThreadsPool::ErrandsPriority errandsPriority{ GoferThreadsPool::ErrandsPriority::High };
+};
+
+// Mean and 99th percentile, in nanoseconds.
+struct Durations
+{
+  double meanNanoseconds{ 0 };
+  double percentile99Nanoseconds{ 0 };
+};
+
+struct Speeds
+{
+  std::string schedulingModeName;
+  GoferThreadsCount goferThreadsCount{ 0 };
+  Durations roundTripDurations;
+  double errandsPerSecond{ 0 };
+  Durations barrierDurations;
+};
+
+/*
+****************
+** PROCEDURES **
+****************
+*/
+
+static decltype(auto)
+NanosecondsSince(std::chrono::steady_clock::time_point const startTime)
+{
+  return static_cast<double>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+static Durations
+DurationsOf(std::vector<double>& nanosecondsSamples)
+{
+  std::sort(nanosecondsSamples.begin(), nanosecondsSamples.end());
+  return { std::accumulate(nanosecondsSamples.cbegin(), nanosecondsSamples.cend(), 0.0) /
+             static_cast<double>(nanosecondsSamples.size()),
+           nanosecondsSamples[((nanosecondsSamples.size() - 1) * 99) / 100] };
+}
+
+/// Measure one scheduling mode with goferThreadsCount gofer threads, each measure repeated repetitionsCount times.
+static Speeds
+TestSpeeds(SchedulingMode const& schedulingMode,
+           GoferThreadsCount const goferThreadsCount,
+           std::size_t const repetitionsCount)
+{
+  GoferThreadsPool goferThreadsPool(goferThreadsCount);
+  if (schedulingMode.configure)
+    schedulingMode.configure(goferThreadsPool);
+  auto const emptyErrand{ GoferThreadsPool::ErrandProcedure([]() {}) };
+  auto const enQueueErrand{ [&](GoferThreadsPool::ErrandsGroup& errandsGroup) {
+    if (schedulingMode.errandsAreGrouped)
+      goferThreadsPool.enQueueErrand(emptyErrand, errandsGroup, schedulingMode.errandsPriority);
+    else
+      goferThreadsPool.enQueueErrand(emptyErrand, schedulingMode.errandsPriority);
+  } };
+  auto const waitForErrandsToComplete{ [&](GoferThreadsPool::ErrandsGroup const& errandsGroup) {
+    if (schedulingMode.errandsAreGrouped)
+      goferThreadsPool.waitForAllErrandsToComplete(errandsGroup);
+    else
+      goferThreadsPool.waitForAllErrandsToComplete();
+  } };
+
+  Speeds speeds{ schedulingMode.name, goferThreadsCount, {}, 0, {} };
+  GoferThreadsPool::ErrandsGroup errandsGroup;
+  std::vector<double> nanosecondsSamples(repetitionsCount);
+
+  // From enqueuing a single empty errand to knowing it completed.
+  for (auto&& nanoseconds : nanosecondsSamples) {
+    auto const startTime{ std::chrono::steady_clock::now() };
+    enQueueErrand(errandsGroup);
+    waitForErrandsToComplete(errandsGroup);
+    nanoseconds = NanosecondsSince(startTime);
+  }
+  speeds.roundTripDurations = DurationsOf(nanosecondsSamples);
+
+  // Contending clients enqueuing empty errands one at a time, as fast as they can.
+  {
+    std::vector<GoferThreadsPool::ErrandsGroup> clientsErrandsGroups(ContendingClientsCount);
+    std::vector<std::thread> clientThreads;
+    auto const startTime{ std::chrono::steady_clock::now() };
+    for (auto&& clientErrandsGroup : clientsErrandsGroups)
+      clientThreads.emplace_back([&]() {
+        for (std::size_t index{ 0 }; index != repetitionsCount; ++index)
+          enQueueErrand(clientErrandsGroup);
+        waitForErrandsToComplete(clientErrandsGroup);
+      });
+    for (auto&& clientThread : clientThreads)
+      clientThread.join();
+    speeds.errandsPerSecond =
+      (static_cast<double>(ContendingClientsCount * repetitionsCount) * 1E9) / NanosecondsSince(startTime);
+  }
+
+  // One empty errand per gofer thread enqueued at once then waited for, as in a training cycle.
+  std::vector<GoferThreadsPool::ErrandProcedure> const barrierErrands(goferThreadsCount, emptyErrand);
+  for (auto&& nanoseconds : nanosecondsSamples) {
+    auto const startTime{ std::chrono::steady_clock::now() };
+    if (schedulingMode.errandsAreGrouped)
+      goferThreadsPool.enQueueErrands(barrierErrands, errandsGroup, true, schedulingMode.errandsPriority);
+    else
+      goferThreadsPool.enQueueErrands(barrierErrands, true, schedulingMode.errandsPriority);
+    waitForErrandsToComplete(errandsGroup);
+    nanoseconds = NanosecondsSince(startTime);
+  }
+  speeds.barrierDurations = DurationsOf(nanosecondsSamples);
+
+  return speeds;
+}
+
+static void
+WriteJson(std::ostream& outputStream,
+          std::vector<Speeds> const& allSpeeds,
+          std::size_t const repetitionsCount)
+{
+  auto const [cpusCount, hardwareThreadsCount, cpusetCpusCount, quotaCpusCount]{ CpuBudget() };
+  auto const writeDurations{ [&](char const* const name, Durations const& durations) {
+    outputStream << ", \"" << name << "MeanNanoseconds\": " << durations.meanNanoseconds << ", \"" << name
+                 << "Percentile99Nanoseconds\": " << durations.percentile99Nanoseconds;
+  } };
+
+  outputStream << std::fixed << std::setprecision(1) << "{\n  \"cpusCount\": " << cpusCount
+               << ",\n  \"hardwareThreadsCount\": " << hardwareThreadsCount
+               << ",\n  \"cpusetCpusCount\": " << cpusetCpusCount << ",\n  \"quotaCpusCount\": " << quotaCpusCount
+               << ",\n  \"repetitionsCount\": " << repetitionsCount
+               << ",\n  \"contendingClientsCount\": " << ContendingClientsCount << ",\n  \"results\": [";
+  for (std::size_t index{ 0 }; index != allSpeeds.size(); ++index) {
+    auto const& speeds{ allSpeeds[index] };
+    outputStream << (index ? ",\n" : "\n") << "    { \"schedulingMode\": \"" << speeds.schedulingModeName
+                 << "\", \"goferThreadsCount\": " << speeds.goferThreadsCount;
+    writeDurations("roundTrip", speeds.roundTripDurations);
+    outputStream << ", \"errandsPerSecond\": " << speeds.errandsPerSecond;
+    writeDurations("barrier", speeds.barrierDurations);
+    outputStream << " }";
+  }
+  outputStream << "\n  ]\n}\n";
+}
+
+/*
+**********
+** MAIN **
+**********
+*/
+
+int
+main(int const argumentsCount, char const* const* const arguments)
+{
+  GoferThreadsCount maximumGoferThreadsCount{ std::max(std::thread::hardware_concurrency(), GoferThreadsCount{ 1 }) };
+  std::size_t repetitionsCount{ 10'000 };
+  std::string jsonFileName{ "testGoferThreadsPoolSpeeds.json" };
+  try {
+    if (argumentsCount > 1)
+      maximumGoferThreadsCount = static_cast<GoferThreadsCount>(std::stoul(arguments[1]));
+    if (argumentsCount > 2)
+      repetitionsCount = std::stoul(arguments[2]);
+    if (argumentsCount > 3)
+      jsonFileName = arguments[3];
+    if ((argumentsCount > 4) or (maximumGoferThreadsCount < GoferThreadsPool::MinimumGoferThreadsCount) or
+        (maximumGoferThreadsCount > GoferThreadsPool::MaximumGoferThreadsCount) or (repetitionsCount < 1))
+      throw false;
+  } catch (...) {
+    std::cout << "Usage: " << arguments[0] << '\n'
+              << "       [ <maximum gofer threads count, the hardware threads count by default>\n"
+              << "       [ <repetitions count, 10000 by default>\n"
+              << "       [ <JSON file name, testGoferThreadsPoolSpeeds.json by default> ] ] ]\n";
+    return EXIT_FAILURE;
+  }
+
+  // The first one is the current default, the others are compared against it.
+  std::vector<SchedulingMode> const schedulingModes{
+    { "default", nullptr },
+    { "park", [](auto& goferThreadsPool) { goferThreadsPool.setMaximumSpinDuration(std::chrono::nanoseconds(0)); } },
+    { "spin",
+      [](auto& goferThreadsPool) {
+        goferThreadsPool.setMaximumSpinDuration(GoferThreadsPool::DefaultMaximumSpinDuration);
+      } },
+    { "errands groups", nullptr, true },
+    { "low priority", nullptr, false, GoferThreadsPool::ErrandsPriority::Low },
+    { "instrumented", [](auto& goferThreadsPool) { goferThreadsPool.setInstrumented(true); } }
+  };
+
+  // Powers of 2, then the maximum.
+  std::vector<GoferThreadsCount> goferThreadsCounts;
+  for (GoferThreadsCount goferThreadsCount{ 1 }; goferThreadsCount < maximumGoferThreadsCount; goferThreadsCount *= 2)
+    goferThreadsCounts.push_back(goferThreadsCount);
+  goferThreadsCounts.push_back(maximumGoferThreadsCount);
+
+  std::cout << std::fixed << std::setprecision(2) << "Mean and 99th percentile in µs over " << repetitionsCount
+            << " repetitions, errands per second enqueued by " << ContendingClientsCount
+            << " clients, for a CPU budget of " << std::get<0>(CpuBudget()) << " CPUs:\n\n"
+            << std::setw(16) << "Scheduling mode" << std::setw(8) << "Threads" << std::setw(24) << "Round-trip"
+            << std::setw(16) << "Errands/sec" << std::setw(24) << "Barrier" << '\n';
+  std::vector<Speeds> allSpeeds;
+  for (auto const& schedulingMode : schedulingModes)
+    for (auto const goferThreadsCount : goferThreadsCounts) {
+      auto const& speeds{ allSpeeds.emplace_back(TestSpeeds(schedulingMode, goferThreadsCount, repetitionsCount)) };
+      std::cout << std::setw(16) << speeds.schedulingModeName << std::setw(8) << speeds.goferThreadsCount
+                << std::setw(12) << (speeds.roundTripDurations.meanNanoseconds / 1E3) << std::setw(12)
+                << (speeds.roundTripDurations.percentile99Nanoseconds / 1E3) << std::setw(16)
+                << speeds.errandsPerSecond << std::setw(12) << (speeds.barrierDurations.meanNanoseconds / 1E3)
+                << std::setw(12) << (speeds.barrierDurations.percentile99Nanoseconds / 1E3) << '\n'
+                << std::flush;
+    }
+
+  std::ofstream jsonFile(jsonFileName);
+  WriteJson(jsonFile, allSpeeds, repetitionsCount);
+  if (not jsonFile) {
+    std::cout << "\nCould not write file '" << jsonFileName << "'.\n";
+    return EXIT_FAILURE;
+  }
+  std::cout << "\nResults written to '" << jsonFileName << "'.\n";
+
+  return EXIT_SUCCESS;
+}
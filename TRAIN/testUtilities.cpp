@@ -89,6 +89,23 @@ TEST_CASE("TypeNameOf()")
   CHECK_MESSAGE(TypeNameOf(string).find("basic_string") != std::string::npos, TypeNameOf(string));
 }
 
+TEST_CASE("CpuBudget()")
+{
+  auto const [cpusCount, hardwareThreadsCount, cpusetCpusCount, quotaCpusCount]{ CpuBudget() };
+  CHECK_GE(cpusCount, 1);
+  CHECK_LE(cpusCount, hardwareThreadsCount);
+  if (cpusetCpusCount)
+    CHECK_LE(cpusCount, cpusetCpusCount);
+  if (quotaCpusCount > 0)
+    CHECK_LE(cpusCount, std::max(quotaCpusCount, 1.0));
+  // Detected once.
+  CHECK_EQ(std::get<0>(CpuBudget()), cpusCount);
+
+  auto const goferThreadsCount{ GoferThreadsPool::defaultGoferThreadsCount() };
+  CHECK_GE(goferThreadsCount, GoferThreadsPool::MinimumGoferThreadsCount);
+  CHECK_LE(goferThreadsCount, std::max(cpusCount, GoferThreadsPool::MinimumGoferThreadsCount));
+}
+
 TEST_CASE("OpenInputBinaryFileNamed()")
 {
   SUBCASE("Non Existing Files")
@@ -607,6 +624,49 @@ TEST_CASE("Array")
   }
 }
 
+TEST_CASE("TraceRecorder")
+{
+  TraceRecorder t(6);
+  CHECK_EQ(t.spansCapacity(), 6);
+  CHECK_EQ(t.recordedSpansCount(), 0);
+  auto const beginTime{ TraceRecorder::Clock::now() };
+  t.record("Main", beginTime, beginTime + std::chrono::microseconds(5));
+  {
+    GoferThreadsPool p(2);
+    p.setTraceRecorder(std::addressof(t));
+    std::vector<std::function<void()>> errands(3, []() {});
+    CHECK_EQ(p.enQueueErrands(errands), 3);
+    p.waitForAllErrandsToComplete();
+    p.setTraceRecorder(nullptr);
+    CHECK_EQ(p.enQueueErrands(errands), 3);
+    p.waitForAllErrandsToComplete();
+  }
+  CHECK_EQ(t.recordedSpansCount(), 4);
+  CHECK_EQ(t.droppedSpansCount(), 0);
+
+  // Beyond the capacity, spans are only counted.
+  for (auto index{ 0 }; index != 4; ++index)
+    t.record("Main", beginTime, beginTime);
+  CHECK_EQ(t.recordedSpansCount(), 6);
+  CHECK_EQ(t.droppedSpansCount(), 2);
+
+  std::ostringstream traceStream;
+  t.writeChromeTraceOn(traceStream);
+  auto const trace{ traceStream.str() };
+  auto const countOf{ [&trace](std::string const& pattern) {
+    std::size_t count{ 0 };
+    for (auto position{ trace.find(pattern) }; position != std::string::npos;
+         position = trace.find(pattern, position + 1))
+      ++count;
+    return count;
+  } };
+  CHECK_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+  CHECK_EQ(countOf("\"ph\":\"X\""), 6);
+  CHECK_EQ(countOf("\"name\":\"Errand\""), 3);
+  CHECK_NE(trace.find("\"dur\":5.000}"), std::string::npos);
+  CHECK_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
 TEST_CASE("GoferThreadsPool" * doctest::timeout(5))
 {
   // For debugging only.
@@ -862,6 +922,355 @@ TEST_CASE("GoferThreadsPool" * doctest::timeout(5))
     TestGoferThreadsPool(VectorSizes * 2);
   }
 
+  SUBCASE("Spin Then Park")
+  {
+    {
+      // Spinning would steal time from the errands.
+      GoferThreadsPool p1(std::max(std::thread::hardware_concurrency(), 1U));
+      CHECK_EQ(p1.maximumSpinDuration().count(), 0);
+      CHECK_EQ(p1.spinDuration().count(), 0);
+
+      GoferThreadsPool p2(3);
+      p2.setMaximumSpinDuration(std::chrono::milliseconds(1));
+      CHECK_EQ(p2.maximumSpinDuration(), std::chrono::milliseconds(1));
+      // No errand was timed yet.
+      CHECK_EQ(p2.spinDuration().count(), 0);
+
+      // Short cycles of short errands, so that both the gofer threads and the client spin.
+      std::atomic<int> a{ 0 };
+      std::vector<std::function<void()>> errands(5, [&a]() { ++a; });
+      for (int cycle{ 0 }; cycle != 1000; ++cycle) {
+        CHECK_EQ(p2.enQueueErrands(errands), 5);
+        p2.waitForAllErrandsToComplete();
+        CHECK_EQ(p2.errandsLeftCount(), 0);
+      }
+      CHECK_EQ(a, 5000);
+      CHECK_LE(p2.spinDuration(), p2.maximumSpinDuration());
+
+      // Long errands push the spin duration up to its maximum.
+      for (int cycle{ 0 }; cycle != 3; ++cycle) {
+        CHECK_UNARY(p2.enQueueErrand([&a]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          ++a;
+        }));
+        CHECK_UNARY(p2.waitForAllErrandsToCompleteFor(std::chrono::seconds(1)));
+      }
+      CHECK_EQ(a, 5003);
+      CHECK_EQ(p2.spinDuration(), p2.maximumSpinDuration());
+
+      // Parking right away still completes all the errands.
+      p2.setMaximumSpinDuration(std::chrono::nanoseconds(0));
+      CHECK_EQ(p2.spinDuration().count(), 0);
+      for (int cycle{ 0 }; cycle != 100; ++cycle) {
+        CHECK_EQ(p2.enQueueErrands(errands), 5);
+        p2.waitForAllErrandsToComplete();
+      }
+      CHECK_EQ(a, 5503);
+      CHECK_EQ(p2.goferThreadsCount(), 3);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+  SUBCASE("Errands Groups")
+  {
+    {
+      GoferThreadsPool p(2);
+      std::atomic<int> a{ 0 }, b{ 0 };
+      // Run before the waits for the group return.
+      std::atomic<int> aCompletions{ 0 };
+      GoferThreadsPool::ErrandsGroup ga([&aCompletions]() { ++aCompletions; }), gb;
+      CHECK_EQ(ga.errandsLeftCount(), 0);
+      // Nothing to wait for.
+      p.waitForAllErrandsToComplete(ga);
+
+      std::vector<std::function<void()>> aErrands(10, [&a]() { ++a; });
+      CHECK_EQ(p.enQueueErrands(aErrands, ga), 10);
+      CHECK_UNARY(p.enQueueErrand(
+        [&b]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(300));
+          ++b;
+        },
+        gb));
+      CHECK_UNARY(p.enQueueErrand([&b]() { ++b; }, gb));
+      // Waits only for the errands of ga, not for the long one of gb.
+      p.waitForAllErrandsToComplete(ga);
+      CHECK_EQ(a, 10);
+      CHECK_EQ(aCompletions, 1);
+      CHECK_EQ(ga.errandsLeftCount(), 0);
+      CHECK_GT(gb.errandsLeftCount(), 0);
+      CHECK_GE(p.errandsLeftCount(), gb.errandsLeftCount());
+
+      // Errands outside any group are also waited for by the pool.
+      CHECK_UNARY(p.enQueueErrand([&a]() { ++a; }));
+      p.waitForAllErrandsToComplete(gb);
+      CHECK_EQ(b, 2);
+      CHECK_EQ(gb.errandsLeftCount(), 0);
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(a, 11);
+      CHECK_EQ(p.errandsLeftCount(), 0);
+
+      // The completion procedure runs again for later errands.
+      CHECK_EQ(p.enQueueErrands(aErrands, ga, false), 10);
+      p.waitForAllErrandsToComplete(ga);
+      CHECK_EQ(a, 21);
+      CHECK_EQ(aCompletions, 2);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+  SUBCASE("Submit")
+  {
+    {
+      GoferThreadsPool p(2);
+      auto f1{ p.submit([]() { return 6 * 7; }) };
+      auto f2{ p.submit([]() -> std::string { throw std::runtime_error("Failed"); }) };
+      std::atomic<int> a{ 0 };
+      auto f3{ p.submit([&a]() { ++a; }) };
+      CHECK_EQ(f1.get(), 42);
+      CHECK_THROWS(f2.get());
+      f3.get();
+      CHECK_EQ(a, 1);
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(p.errandsLeftCount(), 0);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+  SUBCASE("Priorities")
+  {
+    {
+      using Priority = GoferThreadsPool::ErrandsPriority;
+      GoferThreadsPool p(1);
+      std::atomic<bool> go{ false };
+      std::mutex m;
+      std::string order;
+      auto const record{ [&m, &order](char const step) {
+        return [&m, &order, step]() {
+          std::lock_guard const lockGuard(m);
+          order += step;
+        };
+      } };
+      // Keep the only gofer thread busy while queuing.
+      CHECK_UNARY(p.enQueueErrand([&go]() {
+        while (not go)
+          std::this_thread::yield();
+      }));
+      CHECK_UNARY(p.enQueueErrand(record('l'), Priority::Low));
+      CHECK_EQ(p.enQueueErrands(std::vector<std::function<void()>>{ record('m'), record('n') }, true, Priority::Low),
+               2);
+      GoferThreadsPool::ErrandsGroup g;
+      CHECK_UNARY(p.enQueueErrand(record('a'), g));
+      auto f{ p.submit([]() { return 'b'; }) };
+      CHECK_UNARY(p.enQueueErrand(record('c'), g, Priority::High));
+      CHECK_EQ(p.errandsLeftCount(), 7);
+      go = true;
+
+      // High priority errands are all dequeued before the low priority ones, whatever their queuing order.
+      p.waitForAllErrandsToComplete(g);
+      CHECK_EQ(f.get(), 'b');
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(order, "aclmn");
+      CHECK_EQ(p.errandsLeftCount(), 0);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+  SUBCASE("Resize")
+  {
+    {
+      GoferThreadsPool p(2);
+      std::atomic<int> a{ 0 };
+      std::vector<std::function<void()>> errands(12, [&a]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ++a;
+      });
+
+      p.setGoferThreadsCount(4);
+      CHECK_EQ(p.goferThreadsCount(), 4);
+      CHECK_EQ(p.enQueueErrands(errands), 12);
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(a, 12);
+
+      // Shrinking while errands are queued leaves them to the remaining gofer threads.
+      CHECK_EQ(p.enQueueErrands(errands), 12);
+      p.setGoferThreadsCount(1);
+      CHECK_EQ(p.goferThreadsCount(), 1);
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(a, 24);
+      CHECK_EQ(p.errandsLeftCount(), 0);
+
+      p.setGoferThreadsCount(0);
+      CHECK_EQ(p.goferThreadsCount(), GoferThreadsPool::defaultGoferThreadsCount());
+      p.setGoferThreadsCount(3);
+      CHECK_EQ(p.enQueueErrands(errands), 12);
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(a, 36);
+      CHECK_EQ(p.goferThreadsCount(), 3);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+  SUBCASE("Instrumentation")
+  {
+    {
+      GoferThreadsPool p(2);
+      std::vector<std::function<void()>> errands(
+        8, []() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+      CHECK_UNARY_FALSE(p.isInstrumented());
+      CHECK_EQ(p.enQueueErrands(errands), 8);
+      p.waitForAllErrandsToComplete();
+      auto statistics{ p.takeGoferThreadsStatistics() };
+      CHECK_EQ(statistics.size(), 2);
+      for (auto const& goferThreadStatistics : statistics)
+        CHECK_EQ(goferThreadStatistics.runDurations.count(), 0);
+
+      p.setInstrumented(true);
+      CHECK_UNARY(p.isInstrumented());
+      CHECK_EQ(p.enQueueErrands(errands), 8);
+      p.waitForAllErrandsToComplete();
+      statistics = p.takeGoferThreadsStatistics();
+      CHECK_EQ(statistics.size(), 2);
+      uint64_t runCount{ 0 }, queuedCount{ 0 };
+      for (auto const& goferThreadStatistics : statistics) {
+        runCount += goferThreadStatistics.runDurations.count();
+        queuedCount += goferThreadStatistics.queuedDurations.count();
+        if (goferThreadStatistics.runDurations.count()) {
+          CHECK_GE(goferThreadStatistics.runDurations.meanNanoseconds(), 2E6);
+          CHECK_GE(goferThreadStatistics.runDurations.percentileNanoseconds(0.99), 2000000);
+          CHECK_GT(goferThreadStatistics.busyShare(), 0);
+          CHECK_LE(goferThreadStatistics.busyShare(), 1);
+        }
+        CHECK_UNARY_FALSE(goferThreadStatistics.retired);
+      }
+      CHECK_EQ(runCount, 8);
+      CHECK_EQ(queuedCount, 8);
+
+      // Taking resets, and retired gofer threads are still reported.
+      statistics = p.takeGoferThreadsStatistics();
+      for (auto const& goferThreadStatistics : statistics)
+        CHECK_EQ(goferThreadStatistics.runDurations.count(), 0);
+      p.setGoferThreadsCount(1);
+      statistics = p.takeGoferThreadsStatistics();
+      CHECK_EQ(statistics.size(), 2);
+      CHECK_EQ(statistics[0].retired + statistics[1].retired, 1);
+
+      CHECK_EQ(GoferThreadsPool::DurationsHistogram::bucketIndexOf(0), 0);
+      CHECK_EQ(GoferThreadsPool::DurationsHistogram::bucketIndexOf(1), 1);
+      CHECK_EQ(GoferThreadsPool::DurationsHistogram::bucketIndexOf(1024), 11);
+      CHECK_EQ(GoferThreadsPool::DurationsHistogram::bucketIndexOf(~uint64_t{ 0 }),
+               GoferThreadsPool::DurationsHistogram::BucketsCount - 1);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
+#ifdef __cpp_lib_coroutine
+  SUBCASE("Coroutines")
+  {
+    {
+      GoferThreadsPool p(2);
+      std::atomic<int> a{ 0 };
+      std::vector<std::function<void()>> errands(8, [&a]() { ++a; });
+      auto const callingThreadId{ std::this_thread::get_id() };
+      std::thread::id scheduledThreadId, resumedThreadId;
+
+      auto const coroutine{ [&]() -> GoferThreadsPool::Task<int> {
+        co_await p.schedule();
+        scheduledThreadId = std::this_thread::get_id();
+        co_await p.whenAll(errands);
+        resumedThreadId = std::this_thread::get_id();
+        co_await p.whenAll(std::vector<std::function<void()>>());
+        co_return a.load();
+      } };
+      CHECK_EQ(coroutine().get(), 8);
+      CHECK_NE(scheduledThreadId, callingThreadId);
+      CHECK_NE(resumedThreadId, callingThreadId);
+
+      auto const throwingCoroutine{ [&]() -> GoferThreadsPool::Task<> {
+        co_await p.schedule(GoferThreadsPool::ErrandsPriority::Low);
+        throw std::runtime_error("Thrown from a gofer thread.");
+      } };
+      auto task{ throwingCoroutine() };
+      CHECK_THROWS(task.get());
+      p.waitForAllErrandsToComplete();
+      CHECK_EQ(p.errandsLeftCount(), 0);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+#endif
+
+  SUBCASE("Errands Graph")
+  {
+    {
+      GoferThreadsPool p(3);
+      // Per file: load → validate → build, then evaluate once all files are built.
+      constexpr int FilesCount{ 4 };
+      std::mutex m;
+      std::vector<std::string> order;
+      auto const record{ [&m, &order](std::string&& step) {
+        std::lock_guard const lockGuard(m);
+        order.push_back(std::move(step));
+      } };
+      auto const position{ [&order](std::string const& step) {
+        return std::find(order.cbegin(), order.cend(), step) - order.cbegin();
+      } };
+      std::atomic<int> completions{ 0 };
+      GoferThreadsPool::ErrandsGraph g([&completions]() { ++completions; });
+      std::vector<GoferThreadsPool::ErrandsGraph::ErrandIndex> builtIndexes;
+      for (int file{ 0 }; file != FilesCount; ++file) {
+        auto const name{ std::to_string(file) };
+        auto const loaded{ g.addErrand([&record, name]() {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          record("load " + name);
+        }) };
+        auto const validated{ g.addErrand([&record, name]() { record("validate " + name); }, { loaded }) };
+        builtIndexes.push_back(g.addErrand([&record, name]() { record("build " + name); }, { validated }));
+      }
+      auto const joined{ g.addErrand(nullptr, builtIndexes) };
+      g.addErrand([&record]() { record("evaluate"); }, { joined });
+      CHECK_EQ(g.errandsCount(), (FilesCount * 3) + 2);
+      CHECK_THROWS(g.addErrand([]() {}, { g.errandsCount() }));
+
+      for (int run{ 1 }; run != 3; ++run) {
+        order.clear();
+        CHECK_EQ(p.enQueueErrandsGraph(g), FilesCount);
+        p.waitForAllErrandsToComplete(g);
+        CHECK_EQ(g.errandsLeftCount(), 0);
+        CHECK_EQ(completions, run);
+        CHECK_EQ(order.size(), (FilesCount * 3) + 1);
+        for (int file{ 0 }; file != FilesCount; ++file) {
+          auto const name{ std::to_string(file) };
+          CHECK_LT(position("load " + name), position("validate " + name));
+          CHECK_LT(position("validate " + name), position("build " + name));
+          CHECK_LT(position("build " + name), position("evaluate"));
+        }
+        CHECK_EQ(order.back(), "evaluate");
+      }
+
+      // Without dependencies, nothing to wait for.
+      GoferThreadsPool::ErrandsGraph e;
+      CHECK_EQ(p.enQueueErrandsGraph(e), 0);
+      p.waitForAllErrandsToComplete(e);
+
+      displayWaitForThreadsToDie();
+    }
+    displayThreadsDied();
+  }
+
   SUBCASE("Destroy Wait")
   {
     std::vector<std::function<void()>> errands;
@@ -986,3 +1395,55 @@ TEST_CASE("RandomBoolean")
     CHECK_NE(trues, RandomBooleanHalf);
   }
 }
+
+TEST_CASE("FenwickTree")
+{
+  static size_t const FenwickTreeSize{ 1'000 + (static_cast<size_t>(Rand()) % 1'000) };
+
+  // Reference values alongside the Fenwick tree.
+  std::vector<uint64_t> values(FenwickTreeSize, 0);
+  FenwickTree<uint64_t> f(FenwickTreeSize);
+  CHECK_EQ(f.size(), FenwickTreeSize);
+  CHECK_EQ(f.total(), 0);
+  CHECK_EQ(f.find(0), FenwickTreeSize);
+
+  for (size_t i{ 0 }; i != (FenwickTreeSize * 10); ++i) {
+    auto const index{ static_cast<size_t>(Rand()) % FenwickTreeSize };
+    auto const delta{ static_cast<uint64_t>(Rand()) % 100 };
+    values[index] += delta;
+    f.add(index, delta);
+  }
+
+  SUBCASE("Values and Prefix Sums")
+  {
+    uint64_t sum{ 0 };
+    for (size_t index{ 0 }; index != FenwickTreeSize; ++index) {
+      CHECK_EQ(f.prefixSum(index), sum);
+      CHECK_EQ(f[index], values[index]);
+      sum += values[index];
+    }
+    CHECK_EQ(f.total(), sum);
+  }
+
+  SUBCASE("Find")
+  {
+    uint64_t sum{ 0 };
+    for (size_t index{ 0 }; index != FenwickTreeSize; ++index) {
+      if (values[index]) {
+        CHECK_EQ(f.find(sum), index);
+        CHECK_EQ(f.find(sum + values[index] - 1), index);
+      }
+      sum += values[index];
+    }
+    CHECK_EQ(f.find(sum), FenwickTreeSize);
+  }
+
+  SUBCASE("Scale")
+  {
+    auto const total{ f.total() };
+    f.scale(3);
+    CHECK_EQ(f.total(), total * 3);
+    for (size_t index{ 0 }; index != FenwickTreeSize; ++index)
+      CHECK_EQ(f[index], values[index] * 3);
+  }
+}
@@ -0,0 +1,298 @@
+// testWeightsCraftersConvergences.cpp
+
+/** @file
+    Benchmark how the weights crafters converge on the same seeded synthetic events: the ranks total against the
+    training cycles, which measures the search efficiency alone, and against the wall time, which also accounts for
+    the cycles throughput. Each weights crafter trains the same seeded repetitions, and the report gives the mean of
+    each measure with its 95% confidence interval.
+
+    Usage: testWeightsCraftersConvergences [<cycles count> [<repetitions count> [<training threads count> [<seed>]]]]
+
+    @author Nicolas Chaussé
+
+    @copyright Copyright 2022 Nicolas Chaussé (nicolaschausse@protonmail.com)
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3 of the License only.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+    @date 2022
+*/
+
+/*
+**************
+** INCLUDES **
+**************
+*/
+
+#include <cstdio>
+#include <filesystem>
+
+#include "NaiveSupervisedNetworks.hpp"
+
+/*
+*****************
+** DEFINITIONS **
+*****************
+*/
+
+// As in SupervisedNetworkEvent.
+using FileHeaderDatum = uint32_t;
+
+constexpr static FileHeaderDatum const SyntheticEventsCount{ 3 };
+constexpr static FileHeaderDatum const SyntheticMatricesCount{ 500 };
+constexpr static FileHeaderDatum const SyntheticMatrixRowsCount{ 20 };
+constexpr static FileHeaderDatum const SyntheticMatrixColumnsCount{ 5 };
+constexpr static FileHeaderDatum const SyntheticMatrixNameSize{ 8 };
+// Ranks totals are reported at the cycles counts and wall times of these fractions of the whole training.
+constexpr static Index const CheckpointsCount{ 5 };
+
+// Ranks total after each training cycle, the first one being before training, and when it was reached.
+struct Convergence
+{
+  std::vector<Index> ranksTotals;
+  std::vector<double> elapsedSeconds;
+};
+
+/*
+****************
+** PROCEDURES **
+****************
+*/
+
+/** Write a synthetic event file of random walks, as FORMAT/parseStocks.rb would from stocks data.
+    @return The name of the randomly chosen desired matrix.
+*/
+std::string
+writeSyntheticEventFile(std::string const& eventFileName, uint64_t const seed)
+{
+  std::mt19937_64 randomInteger(seed);
+  std::ofstream eventFile(eventFileName, std::ios::binary);
+  FileHeaderDatum const header[]{
+    SyntheticMatricesCount, SyntheticMatrixRowsCount, SyntheticMatrixColumnsCount, SyntheticMatrixNameSize
+  };
+  eventFile.write(reinterpret_cast<char const*>(header), sizeof(header));
+
+  std::vector<MatrixDigraph::Input> inputs(SyntheticMatrixRowsCount * SyntheticMatrixColumnsCount);
+  for (FileHeaderDatum matrixIndex{ 0 }; matrixIndex != SyntheticMatricesCount; ++matrixIndex) {
+    std::array<char, SyntheticMatrixNameSize> matrixName{};
+    std::snprintf(matrixName.data(), matrixName.size(), "S%u", matrixIndex);
+    eventFile.write(matrixName.data(), matrixName.size());
+
+    // Each column walks randomly by up to 2% per row, from a random start.
+    for (FileHeaderDatum columnIndex{ 0 }; columnIndex != SyntheticMatrixColumnsCount; ++columnIndex) {
+      auto value{ static_cast<double>((randomInteger() % 30'000) + 1000) };
+      for (FileHeaderDatum rowIndex{ 0 }; rowIndex != SyntheticMatrixRowsCount; ++rowIndex) {
+        value *= 0.98 + (std::ldexp(static_cast<double>(randomInteger()), -64) * 0.04);
+        inputs[(rowIndex * SyntheticMatrixColumnsCount) + columnIndex] =
+          static_cast<MatrixDigraph::Input>(std::clamp(value, 1.0, 65'535.0));
+      }
+    }
+    eventFile.write(reinterpret_cast<char const*>(inputs.data()),
+                    static_cast<std::streamsize>(inputs.size() * sizeof(MatrixDigraph::Input)));
+  }
+
+  return String('S', randomInteger() % SyntheticMatricesCount);
+}
+
+/// Train a copy of supervisedNetworkEvents with a new weights crafter for cyclesCount cycles.
+Convergence
+trainConvergence(std::vector<SupervisedNetworkEvent> const& supervisedNetworkEvents,
+                 WeightsCrafter::WeightsCrafterInstantiator const& weightsCrafterInstantiator,
+                 long int const cyclesCount,
+                 Index const trainingThreadsCount)
+{
+  auto const weightsCrafterPointer{ weightsCrafterInstantiator(supervisedNetworkEvents[0].requiredWeightsCount()) };
+  weightsCrafterPointer->setWeightsRegions(supervisedNetworkEvents[0].weightsRegions());
+  SupervisedNetworkTrainingRun trainingRun(std::vector<SupervisedNetworkEvent>(supervisedNetworkEvents),
+                                           weightsCrafterPointer);
+  trainingRun.useGoferThreadsCount(trainingThreadsCount);
+
+  Convergence convergence;
+  convergence.ranksTotals.reserve(static_cast<std::size_t>(cyclesCount) + 1);
+  convergence.elapsedSeconds.reserve(static_cast<std::size_t>(cyclesCount) + 1);
+  trainingRun.establishBestState();
+  Timer timer;
+  for (long int cycleIndex{ 0 }; cycleIndex <= cyclesCount; ++cycleIndex) {
+    if (cycleIndex) {
+      trainingRun.trainOneCycle();
+      timer.lap();
+    }
+    convergence.ranksTotals.push_back(trainingRun.ranksTotal());
+    convergence.elapsedSeconds.push_back(
+      cycleIndex ? (static_cast<double>(timer.elapsedTicks()) / Timer::TicksPerSecond) : 0.0);
+  }
+
+  return convergence;
+}
+
+/// @return The mean of samples and the half width of its 95% confidence interval, by Student's t-distribution.
+std::pair<double, double>
+meanAndHalfWidth(std::vector<double> const& samples)
+{
+  // Two-sided 95% quantiles of Student's t-distribution by degrees of freedom, then the normal one beyond.
+  constexpr static double const TQuantiles[]{ 12.71, 4.30, 3.18, 2.78, 2.57, 2.45, 2.36, 2.31, 2.26, 2.23,
+                                              2.20,  2.18, 2.16, 2.14, 2.13, 2.12, 2.11, 2.10, 2.09, 2.09,
+                                              2.08,  2.07, 2.07, 2.06, 2.06, 2.06, 2.05, 2.05, 2.05, 2.04 };
+  auto const samplesCount{ samples.size() };
+  auto const mean{ std::accumulate(samples.cbegin(), samples.cend(), 0.0) / static_cast<double>(samplesCount) };
+  if (samplesCount < 2)
+    return { mean, 0 };
+
+  double squaredDeviationsSum{ 0 };
+  for (auto const sample : samples)
+    squaredDeviationsSum += (sample - mean) * (sample - mean);
+  auto const degreesOfFreedom{ samplesCount - 1 };
+  auto const tQuantile{ (degreesOfFreedom <= std::size(TQuantiles)) ? TQuantiles[degreesOfFreedom - 1] : 1.96 };
+  return { mean,
+           tQuantile * std::sqrt(squaredDeviationsSum / static_cast<double>(degreesOfFreedom)) /
+             std::sqrt(static_cast<double>(samplesCount)) };
+}
+
+/// Print one row of the report: a label, then the mean and confidence interval of each weights crafter's samples.
+void
+printReportRow(std::string const& label, std::vector<std::vector<double>> const& samplesByWeightsCrafter)
+{
+  std::cout << std::setw(14) << label;
+  for (auto const& samples : samplesByWeightsCrafter) {
+    auto const [mean, halfWidth]{ meanAndHalfWidth(samples) };
+    std::cout << std::setw(14) << mean << " ± " << std::setw(9) << std::left << halfWidth << std::right;
+  }
+  std::cout << '\n';
+}
+
+/*
+**********
+** MAIN **
+**********
+*/
+
+int
+main(int const argumentsCount, char const* const* const arguments)
+{
+  long int cyclesCount{ 2000 };
+  Index repetitionsCount{ 5 };
+  Index trainingThreadsCount{ 1 };
+  uint64_t seed{ 1 };
+  try {
+    if (argumentsCount > 1)
+      cyclesCount = std::stol(arguments[1]);
+    if (argumentsCount > 2)
+      repetitionsCount = static_cast<Index>(std::stoul(arguments[2]));
+    if (argumentsCount > 3)
+      trainingThreadsCount = static_cast<Index>(std::stoul(arguments[3]));
+    if (argumentsCount > 4)
+      seed = std::stoull(arguments[4]);
+    if ((argumentsCount > 5) or (cyclesCount < CheckpointsCount) or (repetitionsCount < 1) or
+        (trainingThreadsCount < 1) or (trainingThreadsCount > GoferThreadsPool::MaximumGoferThreadsCount) or
+        (seed == 0))
+      throw false;
+  } catch (...) {
+    std::cout << "Usage: " << arguments[0] << '\n'
+              << "       [ <cycles count, at least " << CheckpointsCount << ", 2000 by default>\n"
+              << "       [ <repetitions count, 5 by default>\n"
+              << "       [ <training threads count, 1 by default>\n"
+              << "       [ <non-zero seed, 1 by default> ] ] ] ]\n";
+    return EXIT_FAILURE;
+  }
+
+  // Same weights crafters as trainInputMatrices.
+  auto const weightsCraftersMap{ NaiveWeightsCraftersMap() };
+  MatrixDigraph::MatrixDigraphInstantiator const matrixDigraphInstantiator{ [](auto rowsCount, auto columnsCount) {
+    return std::make_unique<LogarithmicMatrixDigraph>(rowsCount, columnsCount);
+  } };
+
+  // Build the seeded synthetic events, through temporary event files.
+  Logger logger;
+  std::vector<SupervisedNetworkEvent> supervisedNetworkEvents(SyntheticEventsCount);
+  for (FileHeaderDatum eventIndex{ 0 }; eventIndex != SyntheticEventsCount; ++eventIndex) {
+    auto const eventFileName{ (std::filesystem::temp_directory_path() /
+                               String("SYNTHETIC_EVENT_", seed, '_', eventIndex, ".bin"))
+                                .string() };
+    auto const desiredMatrixName{ writeSyntheticEventFile(eventFileName, seed + eventIndex) };
+    auto eventFileStatus{ OpenInputBinaryFileNamed(eventFileName) };
+    auto const built{ std::get<0>(eventFileStatus).good() and
+                      supervisedNetworkEvents[eventIndex].buildMatrixDigraphs(
+                        logger, desiredMatrixName, eventFileStatus, matrixDigraphInstantiator) };
+    std::get<0>(eventFileStatus).close();
+    std::filesystem::remove(eventFileName);
+    if (not built)
+      return EXIT_FAILURE;
+    supervisedNetworkEvents[eventIndex].setName(String("synthetic event ", eventIndex));
+  }
+
+  // Every weights crafter trains the same repetitions, seeded alike.
+  std::vector<std::vector<Convergence>> convergencesByWeightsCrafter;
+  for (auto const& [weightsCrafterName, weightsCrafterInstantiator] : weightsCraftersMap) {
+    std::cout << "Training " << weightsCrafterName << " for " << repetitionsCount << " repetitions of " << cyclesCount
+              << " cycles on " << trainingThreadsCount << " threads...\n";
+    auto& convergences{ convergencesByWeightsCrafter.emplace_back() };
+    for (Index repetitionIndex{ 0 }; repetitionIndex != repetitionsCount; ++repetitionIndex) {
+      WeightsCrafter::seedFrom(seed + repetitionIndex);
+      convergences.push_back(
+        trainConvergence(supervisedNetworkEvents, weightsCrafterInstantiator, cyclesCount, trainingThreadsCount));
+    }
+  }
+
+  // Report at the wall times all the repetitions reached, so that every weights crafter is measured at each one.
+  auto shortestSeconds{ std::numeric_limits<double>::max() };
+  for (auto const& convergences : convergencesByWeightsCrafter)
+    for (auto const& convergence : convergences)
+      shortestSeconds = std::min(shortestSeconds, convergence.elapsedSeconds.back());
+
+  std::cout << std::fixed << std::setprecision(2) << "\nMean ± 95% confidence interval half width over "
+            << repetitionsCount << " repetitions, seeded from " << seed << ", of "
+            << supervisedNetworkEvents[0].requiredWeightsCount() << " weights ranking " << SyntheticEventsCount
+            << " events of " << SyntheticMatricesCount << " matrices:\n\n"
+            << std::setw(14) << "";
+  for (auto const& [weightsCrafterName, weightsCrafterInstantiator] : weightsCraftersMap)
+    std::cout << std::setw(26) << weightsCrafterName;
+  std::cout << "\n\nRanks total after cycles:\n";
+  for (Index checkpointIndex{ 0 }; checkpointIndex <= CheckpointsCount; ++checkpointIndex) {
+    auto const checkpointCyclesCount{ (cyclesCount * checkpointIndex) / CheckpointsCount };
+    std::vector<std::vector<double>> samplesByWeightsCrafter;
+    for (auto const& convergences : convergencesByWeightsCrafter) {
+      auto& samples{ samplesByWeightsCrafter.emplace_back() };
+      for (auto const& convergence : convergences)
+        samples.push_back(convergence.ranksTotals[static_cast<std::size_t>(checkpointCyclesCount)]);
+    }
+    printReportRow(String(checkpointCyclesCount), samplesByWeightsCrafter);
+  }
+
+  std::cout << "\nRanks total after seconds:\n";
+  for (Index checkpointIndex{ 1 }; checkpointIndex <= CheckpointsCount; ++checkpointIndex) {
+    auto const checkpointSeconds{ (shortestSeconds * checkpointIndex) / CheckpointsCount };
+    std::vector<std::vector<double>> samplesByWeightsCrafter;
+    for (auto const& convergences : convergencesByWeightsCrafter) {
+      auto& samples{ samplesByWeightsCrafter.emplace_back() };
+      for (auto const& convergence : convergences) {
+        // Last ranks total reached by then, the first one being reached at 0 seconds.
+        auto const reachedCount{ std::upper_bound(convergence.elapsedSeconds.cbegin(),
+                                                  convergence.elapsedSeconds.cend(),
+                                                  checkpointSeconds) -
+                                 convergence.elapsedSeconds.cbegin() };
+        samples.push_back(convergence.ranksTotals[static_cast<std::size_t>(reachedCount - 1)]);
+      }
+    }
+    printReportRow(String(std::fixed, std::setprecision(2), checkpointSeconds), samplesByWeightsCrafter);
+  }
+
+  std::cout << "\nCycles per second:\n";
+  std::vector<std::vector<double>> samplesByWeightsCrafter;
+  for (auto const& convergences : convergencesByWeightsCrafter) {
+    auto& samples{ samplesByWeightsCrafter.emplace_back() };
+    for (auto const& convergence : convergences)
+      samples.push_back(static_cast<double>(cyclesCount) / convergence.elapsedSeconds.back());
+  }
+  printReportRow("", samplesByWeightsCrafter);
+
+  return EXIT_SUCCESS;
+}
@@ -75,11 +75,8 @@ main(int const argumentsCount, char const* const* const arguments)
           } }
       };
 
-      // When there will be more then one weights crafter type, they may be selected at run time on the command line.
-      SupervisedNetworkTrainer::WeightsCraftersMap const weightsCraftersMap{
-        { "GeometricWeightsCrafter",
-          [](auto weightsCount) { return std::make_shared<GeometricWeightsCrafter>(weightsCount); } }
-      };
+      // Weights crafter types selectable at run time with option --crafter, the first one by default.
+      auto const weightsCraftersMap{ NaiveWeightsCraftersMap() };
 
       logger.banner() << "Building the supervised network trainer...\n\n";
       SupervisedNetworkTrainer supervisedNetworkTrainer;
@@ -94,6 +91,8 @@ main(int const argumentsCount, char const* const* const arguments)
             static_cast<void>(std::signal(SIGABRT, SIG_DFL));
             static_cast<void>(std::signal(SIGINT, SIG_DFL));
             static_cast<void>(std::signal(SIGTERM, SIG_DFL));
+            static_cast<void>(std::signal(SIGUSR1, SIG_DFL));
+            static_cast<void>(std::signal(SIGUSR2, SIG_DFL));
             GlobalSupervisedNetworkTrainer = nullptr;
           }
         } deallocator;
@@ -109,6 +108,21 @@ main(int const argumentsCount, char const* const* const arguments)
           throw std::runtime_error(String(+"Can not set handler for signal SIGINT in: ", +__PRETTY_FUNCTION__, '.'));
         if (SIG_ERR == std::signal(SIGTERM, exitSignalsHandler))
           throw std::runtime_error(String(+"Can not set handler for signal SIGTERM in: ", +__PRETTY_FUNCTION__, '.'));
+        // In continual mode only, signal SIGUSR1 requests supervisedNetworkTrainer to append the new events.
+        auto const appendSignalHandler{ +[](int const) {
+          GlobalSupervisedNetworkTrainer->requestEventsAppending();
+        } };
+        if ((not supervisedNetworkTrainer.continualControlFileName().empty()) and
+            (SIG_ERR == std::signal(SIGUSR1, appendSignalHandler)))
+          throw std::runtime_error(String(+"Can not set handler for signal SIGUSR1 in: ", +__PRETTY_FUNCTION__, '.'));
+        // In elastic mode with a control file only, signal SIGUSR2 requests supervisedNetworkTrainer to resize its
+        // training threads.
+        auto const resizeSignalHandler{ +[](int const) {
+          GlobalSupervisedNetworkTrainer->requestResizing();
+        } };
+        if ((not supervisedNetworkTrainer.elasticControlFileName().empty()) and
+            (SIG_ERR == std::signal(SIGUSR2, resizeSignalHandler)))
+          throw std::runtime_error(String(+"Can not set handler for signal SIGUSR2 in: ", +__PRETTY_FUNCTION__, '.'));
 
         // Run!
         logger.banner() << "Running the supervised network trainer...\n\n\t███  PRESS Ctrl-C TO STOP!  ███\n";